@@ -6,6 +6,7 @@ All Rights Reserved.
 #include <edtls/client/DTLSClient.h>
 
 #include <memory>
+#include <vector>
 
 #define DEFAULT_MIN_CONNECT_TIMEOUT_MS (100)
 #define DEFAULT_MAX_CONNECT_TIMEOUT_MS (6000)
@@ -20,7 +21,17 @@ DTLSClient::DTLSClient(std::shared_ptr<IClientWrapper> wrapper,
       state_(disconnected),
       logger_(logFunction, "EDTLS_CLNT"),
       maxConnectTimeoutMs_(maxConnectTimeoutMs),
-      minConnectTimeoutMs_(minConnectTimeoutMs) {
+      minConnectTimeoutMs_(minConnectTimeoutMs),
+      asyncSend_(false),
+      sendThread_(),
+      sendMutex_(),
+      sendCondition_(),
+      pendingBuffer_(),
+      sendingBuffer_(),
+      bufferPending_(false),
+      sendThreadRunning_(false),
+      sendFailed_(false),
+      sendStatistics_() {
 #if defined(BUILD_INFO)
   auto buildInfoFormatString = "Build info: %s";
   logger_.Log(buildInfoFormatString, BUILD_INFO);
@@ -57,17 +68,99 @@ DTLSClient::~DTLSClient() {
   close();
 }
 
-unsigned int DTLSClient::send(char *buffer, unsigned int size_bytes) {
+unsigned int DTLSClient::send(const char *buffer, unsigned int size_bytes) {
   unsigned int size_written = 0;
 
-  if (state_ == connected) {
+  if (state_ != connected) {
+    return size_written;
+  }
+
+  if (!sendThreadRunning_) {
     size_written = wrapper_->send(buffer, size_bytes);
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    count_send(size_written, size_bytes);
+    return size_written;
+  }
+
+  std::lock_guard<std::mutex> lock(sendMutex_);
+  if (bufferPending_) {
+    sendStatistics_.dropped++;
   }
+  pendingBuffer_.assign(buffer, buffer + size_bytes);
+  bufferPending_ = true;
+  sendCondition_.notify_one();
 
+  size_written = sendFailed_ ? 0 : size_bytes;
+  sendFailed_ = false;
   return size_written;
 }
 
+void DTLSClient::set_async_send(bool enabled) {
+  asyncSend_ = enabled;
+}
+
+DTLSSendStatistics DTLSClient::get_send_statistics() {
+  std::lock_guard<std::mutex> lock(sendMutex_);
+  return sendStatistics_;
+}
+
+void DTLSClient::start_send_thread() {
+  {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    bufferPending_ = false;
+    sendFailed_ = false;
+    sendThreadRunning_ = true;
+  }
+  sendThread_ = std::thread(&DTLSClient::send_thread, this);
+}
+
+void DTLSClient::stop_send_thread() {
+  {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    sendThreadRunning_ = false;
+  }
+  sendCondition_.notify_one();
+  sendThread_.join();
+}
+
+void DTLSClient::send_thread() {
+  std::unique_lock<std::mutex> lock(sendMutex_);
+  while (true) {
+    sendCondition_.wait(lock, [this] { return bufferPending_ || !sendThreadRunning_; });
+    if (!sendThreadRunning_) {
+      break;
+    }
+
+    /* the caller can queue the next buffer while this one is encrypted and sent */
+    sendingBuffer_.swap(pendingBuffer_);
+    bufferPending_ = false;
+    lock.unlock();
+
+    auto size_bytes = static_cast<unsigned int>(sendingBuffer_.size());
+    auto size_written = wrapper_->send(sendingBuffer_.data(), size_bytes);
+
+    lock.lock();
+    count_send(size_written, size_bytes);
+    if (size_written != size_bytes) {
+      sendFailed_ = true;
+    }
+  }
+}
+
+void DTLSClient::count_send(unsigned int size_written, unsigned int size_bytes) {
+  if (size_written == size_bytes) {
+    sendStatistics_.sent++;
+  } else {
+    sendStatistics_.failed++;
+  }
+}
+
 bool DTLSClient::connect(const char *address, const char *port, const PSKInfo &pskInfo) {
+  return connect(address, port, pskInfo, std::vector<unsigned char>());
+}
+
+bool DTLSClient::connect(const char *address, const char *port, const PSKInfo &pskInfo,
+                         const std::vector<unsigned char> &session) {
   close();
 
   wrapper_->init(this, maxConnectTimeoutMs_, minConnectTimeoutMs_);
@@ -76,8 +169,15 @@ bool DTLSClient::connect(const char *address, const char *port, const PSKInfo &p
     return false;
   }
 
+  if (!session.empty() && !wrapper_->set_session(session)) {
+    logger_.Log("Restoring session failed, performing full handshake");
+  }
+
   if (wrapper_->handshake()) {
     state_ = connected;
+    if (asyncSend_) {
+      start_send_thread();
+    }
     return true;
   } else {
     if (clientNotifier_) clientNotifier_->handshakeFailed();
@@ -86,8 +186,19 @@ bool DTLSClient::connect(const char *address, const char *port, const PSKInfo &p
   return false;
 }
 
+bool DTLSClient::get_session(std::vector<unsigned char> *session) {
+  if (state_ != connected) {
+    return false;
+  }
+
+  return wrapper_->get_session(session);
+}
+
 void DTLSClient::close() {
   if (state_ == connected) {
+    if (sendThreadRunning_) {
+      stop_send_thread();
+    }
     wrapper_->close();
     wrapper_->deinit();
     state_ = disconnected;
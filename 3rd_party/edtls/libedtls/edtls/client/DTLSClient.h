@@ -10,10 +10,24 @@ All Rights Reserved.
 #include <edtls/client/IClientNotifier.h>
 #include <edtls/client/IDTLSClient.h>
 
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 enum ClientState { connected, disconnected };
 
+struct DTLSSendStatistics {
+  uint64_t sent;
+  uint64_t failed;
+  /* buffers replaced by a newer one before the send thread picked them up */
+  uint64_t dropped;
+};
+
 class DTLSClient: public IDTLSClient {
  private:
   std::shared_ptr<IClientWrapper> wrapper_;
@@ -25,6 +39,23 @@ class DTLSClient: public IDTLSClient {
   unsigned int minConnectTimeoutMs_;
   virtual void handle_peer_closed();
 
+  bool asyncSend_;
+  std::thread sendThread_;
+  std::mutex sendMutex_;
+  std::condition_variable sendCondition_;
+  std::vector<char> pendingBuffer_;
+  std::vector<char> sendingBuffer_;
+  bool bufferPending_;
+  /* written under sendMutex_, read without it by send() and close() */
+  std::atomic<bool> sendThreadRunning_;
+  bool sendFailed_;
+  DTLSSendStatistics sendStatistics_;
+
+  void start_send_thread();
+  void stop_send_thread();
+  void send_thread();
+  void count_send(unsigned int size_written, unsigned int size_bytes);
+
  public:
   DTLSClient(std::shared_ptr<IClientWrapper> wrapper,
              IClientNotifier *clientNotifier);
@@ -48,8 +79,25 @@ class DTLSClient: public IDTLSClient {
   DTLSClient& operator=(const DTLSClient&) = delete;
 
   bool connect(const char *address, const char *port, const PSKInfo &pskInfo);
+
+  /* offers a session saved by get_session for an abbreviated handshake,
+   * the server falls back to a full handshake when it does not know the session */
+  bool connect(const char *address, const char *port, const PSKInfo &pskInfo,
+               const std::vector<unsigned char> &session);
+
+  /* saves the session of the current connection so a later connect can resume it */
+  bool get_session(std::vector<unsigned char> *session);
   void close();
-  unsigned int send(char *buffer, unsigned int size_bytes);
+  /* the buffer is copied into the record buffer of the ssl context and encrypted in place there,
+   * in async mode it is copied into the send slot first */
+  unsigned int send(const char *buffer, unsigned int size_bytes);
+
+  /* when enabled, send copies the buffer into a single slot which a separate thread encrypts and sends,
+   * so the caller never waits for the network. A buffer which was not picked up yet is replaced by the
+   * next one, and a failure of the send thread is reported by returning 0 from the next send.
+   * Takes effect on the next connect. */
+  void set_async_send(bool enabled);
+  DTLSSendStatistics get_send_statistics();
 };
 
 #endif  // EDTLS_CLIENT_DTLSCLIENT_H_
@@ -13,7 +13,7 @@ class IDTLSClient: public IClientConnectionHandler {
  public:
   virtual bool connect(const char *address, const char *port, const PSKInfo &pskInfo) = 0;
   virtual void close() = 0;
-  virtual unsigned int send(char *buffer, unsigned int size_bytes) = 0;
+  virtual unsigned int send(const char *buffer, unsigned int size_bytes) = 0;
 };
 
 #endif  // EDTLS_CLIENT_IDTLSCLIENT_H_
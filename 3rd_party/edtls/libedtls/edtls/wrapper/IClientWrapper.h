@@ -10,6 +10,8 @@ All Rights Reserved.
 #include <edtls/wrapper/PSKInfo.h>
 #include <edtls/logger/Logger.h>
 
+#include <vector>
+
 class IClientWrapper {
  protected:
   Logger logger_;
@@ -24,7 +26,18 @@ class IClientWrapper {
   virtual void close() = 0;
   virtual bool connect(const char *address, const char *port, const PSKInfo &pskInfo) = 0;
   virtual bool handshake() = 0;
-  virtual unsigned int send(char *buffer, unsigned int size_bytes) = 0;
+  virtual unsigned int send(const char *buffer, unsigned int size_bytes) = 0;
+
+  /* session resumption is optional, a wrapper without support always performs a full handshake */
+  virtual bool get_session(std::vector<unsigned char> *session) {
+    (void) session;
+    return false;
+  }
+
+  virtual bool set_session(const std::vector<unsigned char> &session) {
+    (void) session;
+    return false;
+  }
 };
 
 #endif  // EDTLS_WRAPPER_ICLIENTWRAPPER_H_
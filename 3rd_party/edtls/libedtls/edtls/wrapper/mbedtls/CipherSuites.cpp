@@ -0,0 +1,61 @@
+/*******************************************************************************
+Copyright © 2016 Philips Lighting Holding B.V.
+All Rights Reserved.
+********************************************************************************/
+
+#include <edtls/wrapper/mbedtls/CipherSuites.h>
+
+#include <mbedtls/build_info.h>
+#include <mbedtls/ssl_ciphersuites.h>
+
+#include <vector>
+
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    (defined(__amd64__) || defined(__x86_64__))
+#define EDTLS_AESNI
+#include <cpuid.h>
+#elif defined(MBEDTLS_AESCE_C) && defined(__aarch64__) && defined(__linux__)
+#define EDTLS_AESCE_HWCAP
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#elif defined(MBEDTLS_AESCE_C) && defined(__aarch64__) && defined(__APPLE__)
+#define EDTLS_AESCE
+#endif
+
+bool has_aes_acceleration() {
+#if defined(EDTLS_AESNI)
+  /* same check as mbedtls_aesni_has_support(), which is not part of the public api */
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+    return false;
+  }
+  return (ecx & bit_AES) != 0 && (ecx & bit_PCLMUL) != 0;
+#elif defined(EDTLS_AESCE_HWCAP)
+  auto hwcap = getauxval(AT_HWCAP);
+  return (hwcap & HWCAP_AES) != 0 && (hwcap & HWCAP_PMULL) != 0;
+#elif defined(EDTLS_AESCE)
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::vector<int> get_default_ciphersuites() {
+  if (has_aes_acceleration()) {
+    return {MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256,
+            MBEDTLS_TLS_PSK_WITH_CHACHA20_POLY1305_SHA256};
+  }
+  return {MBEDTLS_TLS_PSK_WITH_CHACHA20_POLY1305_SHA256,
+          MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256};
+}
+
+std::vector<int> get_supported_ciphersuites(const std::vector<int> &suites) {
+  std::vector<int> supported;
+  for (auto suite : suites) {
+    if (suite != 0 && mbedtls_ssl_ciphersuite_from_id(suite) != nullptr) {
+      supported.push_back(suite);
+    }
+  }
+  supported.push_back(0);
+  return supported;
+}
@@ -0,0 +1,24 @@
+/*******************************************************************************
+Copyright © 2016 Philips Lighting Holding B.V.
+All Rights Reserved.
+********************************************************************************/
+
+#ifndef EDTLS_WRAPPER_MBEDTLS_CIPHERSUITES_H_
+#define EDTLS_WRAPPER_MBEDTLS_CIPHERSUITES_H_
+
+#include <vector>
+
+/* true when this mbedtls build encrypts AES-GCM with the AES and carry-less multiply
+ * instructions of the cpu it runs on (AES-NI/PCLMUL on x86-64, Crypto Extensions on ARMv8) */
+bool has_aes_acceleration();
+
+/* PSK AEAD suites in order of preference for this cpu: AES-GCM first when it is
+ * accelerated, ChaCha20-Poly1305 first when AES runs in software.
+ * TLS_PSK_WITH_AES_128_GCM_SHA256 is always included, it is the suite the bridge requires */
+std::vector<int> get_default_ciphersuites();
+
+/* zero terminated copy of suites for mbedtls_ssl_conf_ciphersuites, without the suites
+ * that are not compiled into this mbedtls build */
+std::vector<int> get_supported_ciphersuites(const std::vector<int> &suites);
+
+#endif  // EDTLS_WRAPPER_MBEDTLS_CIPHERSUITES_H_
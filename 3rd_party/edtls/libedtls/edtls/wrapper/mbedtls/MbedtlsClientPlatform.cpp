@@ -4,14 +4,26 @@ All Rights Reserved.
 ********************************************************************************/
 
 #include <edtls/wrapper/mbedtls/MbedtlsClientPlatform.h>
+#include <edtls/wrapper/mbedtls/CipherSuites.h>
+
+#include <vector>
 
 MbedtlsClientPlatform::MbedtlsClientPlatform(LogFunction log_function,
                                              EntropyProviderBasePtr entropy_provider,
                                              TimerProviderPtr timer_provider,
                                              UDPClientBasePtr udpClient)
-    : MbedtlsPlatform(log_function, entropy_provider, timer_provider), udpClient_(udpClient) {
+    : MbedtlsPlatform(log_function, entropy_provider, timer_provider), udpClient_(udpClient),
+      ciphersuites_(get_default_ciphersuites()) {
 }
 
 UDPClientBasePtr MbedtlsClientPlatform::get_udp_client() {
   return udpClient_;
 }
+
+void MbedtlsClientPlatform::set_ciphersuites(const std::vector<int> &ciphersuites) {
+  ciphersuites_ = ciphersuites;
+}
+
+std::vector<int> MbedtlsClientPlatform::get_ciphersuites() {
+  return ciphersuites_;
+}
@@ -10,6 +10,7 @@ All Rights Reserved.
 #include <edtls/wrapper/mbedtls/MbedtlsPlatform.h>
 
 #include <memory>
+#include <vector>
 
 class MbedtlsClientPlatform : public MbedtlsPlatform {
  public:
@@ -19,8 +20,12 @@ class MbedtlsClientPlatform : public MbedtlsPlatform {
                           TimerProviderPtr timer_provider,
                           UDPClientBasePtr udpClient);
   UDPClientBasePtr get_udp_client();
+  /* suites offered in the client hello, most preferred first; defaults to get_default_ciphersuites() */
+  void set_ciphersuites(const std::vector<int> &ciphersuites);
+  std::vector<int> get_ciphersuites();
  protected:
   UDPClientBasePtr udpClient_;
+  std::vector<int> ciphersuites_;
 };
 
 typedef std::shared_ptr<MbedtlsClientPlatform> MbedtlsClientPlatformPtr;
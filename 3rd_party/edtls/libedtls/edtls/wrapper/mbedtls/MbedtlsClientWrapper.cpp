@@ -4,9 +4,11 @@ All Rights Reserved.
 ********************************************************************************/
 
 #include <edtls/wrapper/mbedtls/MbedtlsClientWrapper.h>
+#include <edtls/wrapper/mbedtls/CipherSuites.h>
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 static void my_debug(void *arg, int level,
                      const char *file, int line,
@@ -26,6 +28,7 @@ MbedtlsClientWrapper::MbedtlsClientWrapper(MbedtlsClientPlatformPtr platform)
       ssl_(),
       conf_(),
       ctr_drbg_(),
+      supportedCS_(),
       connectionHandler_() {
 }
 
@@ -90,7 +93,16 @@ bool MbedtlsClientWrapper::setup_structure(unsigned int maxConnectTimeout, unsig
 //    mbedtls_ssl_conf_authmode( &conf, MBEDTLS_SSL_VERIFY_OPTIONAL );
 //    mbedtls_ssl_conf_ca_chain( &conf, &cacert, NULL );
   mbedtls_ssl_conf_authmode(&conf_, MBEDTLS_SSL_VERIFY_NONE);
-  mbedtls_ssl_conf_ciphersuites(&conf_, supportedCS_);
+
+  /* mbedtls keeps a pointer to the list, it has to stay alive as long as conf_ */
+  supportedCS_ = get_supported_ciphersuites(platform_->get_ciphersuites());
+  if (supportedCS_.size() <= 1) {
+    logger_.Log("Setting up the structure failed! None of the configured cipher suites is supported");
+    return false;
+  }
+  logger_.Log("Offering %u cipher suites, AES acceleration %s",
+              static_cast<unsigned int>(supportedCS_.size() - 1), has_aes_acceleration() ? "on" : "off");
+  mbedtls_ssl_conf_ciphersuites(&conf_, supportedCS_.data());
   mbedtls_ssl_conf_rng(&conf_, mbedtls_ctr_drbg_random, &ctr_drbg_);
 
   if (logger_.GetLogFunction()) {
@@ -98,6 +110,11 @@ bool MbedtlsClientWrapper::setup_structure(unsigned int maxConnectTimeout, unsig
   }
 
   mbedtls_ssl_conf_handshake_timeout(&conf_, minConnectTimeout, maxConnectTimeout);
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+  mbedtls_ssl_conf_session_tickets(&conf_, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
   if ((ret = mbedtls_ssl_setup(&ssl_, &conf_)) != 0) {
     logger_.Log("Setting up the structure failed! mbedtls_ssl_setup returned %d", ret);
     return false;
@@ -144,11 +161,11 @@ bool MbedtlsClientWrapper::connect(const char *address, const char *port, const
   return true;
 }
 
-unsigned int MbedtlsClientWrapper::send(char *buffer, unsigned int size_bytes) {
+unsigned int MbedtlsClientWrapper::send(const char *buffer, unsigned int size_bytes) {
   int ret;
 
   do {
-    ret = mbedtls_ssl_write(&ssl_, reinterpret_cast<unsigned char *>(buffer), size_bytes);
+    ret = mbedtls_ssl_write(&ssl_, reinterpret_cast<const unsigned char *>(buffer), size_bytes);
   } while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
 
   if (ret < 0) {
@@ -159,6 +176,51 @@ unsigned int MbedtlsClientWrapper::send(char *buffer, unsigned int size_bytes) {
   return static_cast<unsigned int>(ret);
 }
 
+bool MbedtlsClientWrapper::get_session(std::vector<unsigned char> *session) {
+  int ret;
+  mbedtls_ssl_session saved;
+  mbedtls_ssl_session_init(&saved);
+
+  if ((ret = mbedtls_ssl_get_session(&ssl_, &saved)) != 0) {
+    logger_.Log("Saving session failed! mbedtls_ssl_get_session returned %d", ret);
+    mbedtls_ssl_session_free(&saved);
+    return false;
+  }
+
+  /* the first call only determines the size of the serialized session */
+  size_t length = 0;
+  mbedtls_ssl_session_save(&saved, nullptr, 0, &length);
+  session->resize(length);
+  ret = mbedtls_ssl_session_save(&saved, session->data(), session->size(), &length);
+  mbedtls_ssl_session_free(&saved);
+
+  if (ret != 0) {
+    logger_.Log("Saving session failed! mbedtls_ssl_session_save returned %d", ret);
+    session->clear();
+    return false;
+  }
+
+  return true;
+}
+
+bool MbedtlsClientWrapper::set_session(const std::vector<unsigned char> &session) {
+  int ret;
+  mbedtls_ssl_session saved;
+  mbedtls_ssl_session_init(&saved);
+
+  if ((ret = mbedtls_ssl_session_load(&saved, session.data(), session.size())) == 0) {
+    ret = mbedtls_ssl_set_session(&ssl_, &saved);
+  }
+  mbedtls_ssl_session_free(&saved);
+
+  if (ret != 0) {
+    logger_.Log("Restoring session failed! mbedtls returned %d", ret);
+    return false;
+  }
+
+  return true;
+}
+
 bool MbedtlsClientWrapper::seed_random_number_generator() {
   int ret;
   logger_.Log("Seeding the Client random number generator...");
@@ -207,7 +269,7 @@ bool MbedtlsClientWrapper::handshake() {
     return false;
   }
 
-  logger_.Log("Handshake ok");
+  logger_.Log("Handshake ok, using %s", mbedtls_ssl_get_ciphersuite(&ssl_));
 
   return true;
 }
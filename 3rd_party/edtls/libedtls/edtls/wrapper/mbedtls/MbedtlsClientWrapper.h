@@ -18,6 +18,7 @@ All Rights Reserved.
 #endif
 
 #include <string.h>
+#include <vector>
 #include <edtls/wrapper/mbedtls/UDPClientBase.h>
 
 #include <mbedtls/debug.h>
@@ -44,7 +45,7 @@ class MbedtlsClientWrapper: public IClientWrapper {
   mbedtls_ssl_context ssl_;
   mbedtls_ssl_config conf_;
   mbedtls_ctr_drbg_context ctr_drbg_;
-  const int supportedCS_[1] = {MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256};
+  std::vector<int> supportedCS_;
   const char *pers_ = "dtls_client";
   IClientConnectionHandler* connectionHandler_;
 
@@ -62,7 +63,9 @@ class MbedtlsClientWrapper: public IClientWrapper {
   virtual void deinit();
   virtual void close();
   virtual bool connect(const char *address, const char *port, const PSKInfo &pskInfo);
-  virtual unsigned int send(char *buffer, unsigned int size_bytes);
+  virtual unsigned int send(const char *buffer, unsigned int size_bytes);
+  virtual bool get_session(std::vector<unsigned char> *session);
+  virtual bool set_session(const std::vector<unsigned char> &session);
 };
 
 #endif  // EDTLS_WRAPPER_MBEDTLS_MBEDTLSCLIENTWRAPPER_H_
@@ -76,7 +76,7 @@ struct MbedtlsSessionContext: public SessionContextBase{
 #if defined(MBEDTLS_SSL_CACHE_C)
   mbedtls_ssl_cache_context cache_;
 #endif
-  const int supportedCS_[1] = {MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256};
+  const int supportedCS_[2] = {MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256, 0};
 };
 
 struct PskCallbackContainer{
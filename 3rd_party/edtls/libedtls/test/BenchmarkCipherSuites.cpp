@@ -0,0 +1,98 @@
+/*******************************************************************************
+Copyright © 2016 Philips Lighting Holding B.V.
+All Rights Reserved.
+********************************************************************************/
+
+/* Measures the record encryption cost per streaming frame of the PSK AEAD suites,
+ * using the same mbedtls cipher as the DTLS record layer does for each suite. */
+
+#include <mbedtls/build_info.h>
+#include <mbedtls/cipher.h>
+#include <mbedtls/ssl_ciphersuites.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+#include "edtls/wrapper/mbedtls/CipherSuites.h"
+
+struct SuiteCipher {
+  int suite;
+  mbedtls_cipher_type_t cipher;
+  size_t key_length;
+  size_t tag_length;
+};
+
+static const SuiteCipher suites[] = {
+    {MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256, MBEDTLS_CIPHER_AES_128_GCM, 16, 16},
+    {MBEDTLS_TLS_PSK_WITH_AES_256_GCM_SHA384, MBEDTLS_CIPHER_AES_256_GCM, 32, 16},
+    {MBEDTLS_TLS_PSK_WITH_AES_128_CCM, MBEDTLS_CIPHER_AES_128_CCM, 16, 16},
+    {MBEDTLS_TLS_PSK_WITH_AES_128_CCM_8, MBEDTLS_CIPHER_AES_128_CCM, 16, 8},
+    {MBEDTLS_TLS_PSK_WITH_CHACHA20_POLY1305_SHA256, MBEDTLS_CIPHER_CHACHA20_POLY1305, 32, 16},
+};
+
+/* header and 20 channels of an entertainment api v2 message */
+static const size_t frame_size = 52 + 20 * 7;
+static const int frames = 100000;
+
+static bool benchmark(const SuiteCipher &suite, double *ns_per_frame) {
+  auto info = mbedtls_cipher_info_from_type(suite.cipher);
+  if (info == nullptr) {
+    return false;
+  }
+
+  mbedtls_cipher_context_t ctx;
+  mbedtls_cipher_init(&ctx);
+  std::vector<unsigned char> key(suite.key_length, 0x2a);
+  if (mbedtls_cipher_setup(&ctx, info) != 0 ||
+      mbedtls_cipher_setkey(&ctx, key.data(), static_cast<int>(key.size() * 8), MBEDTLS_ENCRYPT) != 0) {
+    mbedtls_cipher_free(&ctx);
+    return false;
+  }
+
+  /* 12 byte nonce and the 13 byte additional data of a DTLS 1.2 record */
+  unsigned char iv[12] = {0};
+  unsigned char ad[13] = {0};
+  std::vector<unsigned char> plain(frame_size, 0x55);
+  std::vector<unsigned char> record(frame_size + suite.tag_length);
+
+  bool ok = true;
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames && ok; ++i) {
+    iv[11] = static_cast<unsigned char>(i);
+    iv[10] = static_cast<unsigned char>(i >> 8);
+    size_t length = 0;
+    ok = mbedtls_cipher_auth_encrypt_ext(&ctx, iv, sizeof(iv), ad, sizeof(ad),
+                                         plain.data(), plain.size(),
+                                         record.data(), record.size(), &length, suite.tag_length) == 0;
+  }
+  auto duration = std::chrono::steady_clock::now() - begin;
+  mbedtls_cipher_free(&ctx);
+
+  *ns_per_frame = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / frames;
+  return ok;
+}
+
+int main() {
+  printf("AES acceleration: %s\n", has_aes_acceleration() ? "on" : "off");
+  printf("Encrypting %d frames of %u bytes\n", frames, static_cast<unsigned int>(frame_size));
+
+  auto preferred = get_supported_ciphersuites(get_default_ciphersuites());
+  for (const auto &suite : suites) {
+    auto name = mbedtls_ssl_get_ciphersuite_name(suite.suite);
+    double ns_per_frame = 0;
+    if (!benchmark(suite, &ns_per_frame)) {
+      printf("%-45s not available\n", name);
+      continue;
+    }
+    auto position = 0;
+    while (preferred[position] != 0 && preferred[position] != suite.suite) {
+      ++position;
+    }
+    printf("%-45s %8.0f ns/frame%s\n", name, ns_per_frame,
+           preferred[position] == 0 ? "" : (position == 0 ? "  (preferred)" : "  (offered)"));
+  }
+  return EXIT_SUCCESS;
+}
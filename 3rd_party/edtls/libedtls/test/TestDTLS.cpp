@@ -16,6 +16,10 @@ All Rights Reserved.
 #include "edtls/wrapper/mbedtls/DefaultEntropyProvider.h"
 #include "edtls/wrapper/mbedtls/DefaultTimerProvider.h"
 #include "edtls/wrapper/mbedtls/DefaultUDPClient.h"
+#include "edtls/wrapper/mbedtls/CipherSuites.h"
+
+#include <algorithm>
+#include <vector>
 
 using ::testing::_;
 using ::testing::Mock;
@@ -25,6 +29,7 @@ using ::testing::SetArgPointee;
 using ::testing::InvokeWithoutArgs;
 using ::testing::StrEq;
 using ::testing::Range;
+using ::testing::Between;
 
 MATCHER_P(charStringMatcher, expCharString, "String does not match") {
   return strcmp((const char *) arg, (const char *) expCharString) == 0;
@@ -105,7 +110,7 @@ class ACTestDTLS: public testing::TestWithParam<int> {
     TimeoutTrigger received_data_trigger;
     EXPECT_CALL(*serverNotifier, receive_data(charStringMatcher(data), strlen(data) + 1)).Times(1).WillOnce(
         InvokeWithoutArgs(&received_data_trigger, &TimeoutTrigger::trigger));
-    ASSERT_GT(client->send(const_cast<char *>(data), strlen(data) + 1), (unsigned int)0);
+    ASSERT_GT(client->send(data, strlen(data) + 1), (unsigned int)0);
     received_data_trigger.wait_for_trigger(5000);
   }
 
@@ -166,6 +171,33 @@ TEST_P(ACTestDTLS, InputStringFromClientMustMatchOutputStringOnServer) {
   sendAndTestData(&client, str, &serverNotifier);
 }
 
+TEST_P(ACTestDTLS, AsyncSendMustArriveOnServer) {
+  MockIServerNotifier serverNotifier;
+  auto pskProvider = std::make_shared<MockIPSKProvider>();
+
+  EXPECT_CALL(*pskProvider,
+              getKey(MemoryMatcher((const unsigned char *) "Client_identity", strlen("Client_identity")),
+                     strlen("Client_identity"),
+                     _)).WillOnce(DoAll(SetArgPointee<2>(std::vector<unsigned char>({0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+                                                                                     0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+                                                                                     0x0c, 0x0d, 0x0e, 0x0f})),
+                                        Return(true)));
+
+  MockIClientNotifier clientNotifier;
+  DTLSClient client(MbedtlsClientWrapperFactory::get(CreateClientPlatform()), &clientNotifier);
+  DTLSServer server(MbedtlsServerWrapperFactory::get(CreateServerPlatform(pskProvider)), &serverNotifier, DefaultPrintfLogger);
+  PSKInfo pskInfo("Client_identity",
+                  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f});
+
+  client.set_async_send(true);
+  startServer(&server, "127.0.0.1", "1337", 10);
+  ASSERT_TRUE(connectClient(&client, "127.0.0.1", "1337", pskInfo));
+  sendAndTestData(&client, "Hello World!", &serverNotifier);
+
+  ASSERT_TRUE_WITH_TIMEOUT(client.get_send_statistics().sent == 1, 1000);
+  EXPECT_EQ(0u, client.get_send_statistics().failed);
+}
+
 TEST_P(ACTestDTLS, StopServerAfterTimeout) {
   MockIServerNotifier serverNotifier;
   auto pskProvider = std::make_shared<MockIPSKProvider>();
@@ -311,6 +343,78 @@ TEST_P(ACTestDTLS, HandleClientReconnect) {
   sendAndTestData(client2, "Hello World!", &serverNotifier);
 }
 
+TEST_P(ACTestDTLS, ReconnectWithSavedSession) {
+  MockIServerNotifier serverNotifier;
+  MockIClientNotifier clientNotifier;
+  auto pskProvider = std::make_shared<MockIPSKProvider>();
+
+  EXPECT_CALL(*pskProvider,
+              getKey(MemoryMatcher((const unsigned char *) "Client_identity", strlen("Client_identity")),
+                     strlen("Client_identity"),
+                     _)).Times(Between(1, 2)).WillRepeatedly(DoAll(SetArgPointee<2>(std::vector<unsigned char>({0x00, 0x01, 0x02,
+                                                                                                            0x03, 0x04, 0x05,
+                                                                                                            0x06, 0x07, 0x08,
+                                                                                                            0x09, 0x0a, 0x0b,
+                                                                                                            0x0c, 0x0d, 0x0e,
+                                                                                                            0x0f})),
+                                                               Return(true)));
+  EXPECT_CALL(clientNotifier, handshakeFailed()).Times(0);
+
+  DTLSServer server(MbedtlsServerWrapperFactory::get(CreateServerPlatform(pskProvider)), &serverNotifier, DefaultPrintfLogger);
+  DTLSClient client(MbedtlsClientWrapperFactory::get(CreateClientPlatform()), &clientNotifier);
+  PSKInfo pskInfo("Client_identity",
+                  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f});
+
+  startServer(&server, "127.0.0.1", "1337", 10);
+  ASSERT_TRUE(connectClient(&client, "127.0.0.1", "1337", pskInfo));
+  std::vector<unsigned char> session;
+  ASSERT_TRUE(client.get_session(&session));
+  ASSERT_FALSE(session.empty());
+
+  TimeoutTrigger peer_closed_trigger;
+  EXPECT_CALL(serverNotifier, peer_closed()).Times(1).WillOnce(InvokeWithoutArgs(&peer_closed_trigger,
+                                                                                 &TimeoutTrigger::trigger));
+  client.close();
+  peer_closed_trigger.wait_for_trigger(5000);
+  ASSERT_FALSE(client.get_session(&session));
+
+  startServer(&server, "127.0.0.1", "1337", 10);
+  ASSERT_TRUE(client.connect("127.0.0.1", "1337", pskInfo, session));
+  sendAndTestData(&client, "Hello World!", &serverNotifier);
+}
+
+TEST_P(ACTestDTLS, DefaultCipherSuitesIncludeBridgeSuite) {
+  auto suites = get_supported_ciphersuites(get_default_ciphersuites());
+  ASSERT_FALSE(suites.empty());
+  EXPECT_EQ(0, suites.back());
+  EXPECT_NE(suites.end(), std::find(suites.begin(), suites.end(), MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256));
+  if (has_aes_acceleration()) {
+    EXPECT_EQ(MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256, suites.front());
+  }
+
+  EXPECT_EQ(std::vector<int>({MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256, 0}),
+            get_supported_ciphersuites({0x7FFF, MBEDTLS_TLS_PSK_WITH_AES_128_GCM_SHA256}));
+}
+
+TEST_P(ACTestDTLS, HandleNoCommonCipherSuite) {
+  MockIServerNotifier serverNotifier;
+  MockIClientNotifier clientNotifier;
+  auto pskProvider = std::make_shared<MockIPSKProvider>();
+
+  DTLSServer server(MbedtlsServerWrapperFactory::get(CreateServerPlatform(pskProvider)), &serverNotifier, DefaultPrintfLogger);
+  auto clientPlatform = CreateClientPlatform();
+  clientPlatform->set_ciphersuites({MBEDTLS_TLS_PSK_WITH_CHACHA20_POLY1305_SHA256});
+  DTLSClient client(MbedtlsClientWrapperFactory::get(clientPlatform), &clientNotifier);
+  PSKInfo pskInfo("Client_identity",
+                  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f});
+
+  EXPECT_CALL(*pskProvider, getKey(_, _, _)).Times(0);
+  EXPECT_CALL(clientNotifier, handshakeFailed()).Times(1);
+  startServer(&server, "127.0.0.1", "1337", 10);
+  ASSERT_FALSE(connectClient(&client, "127.0.0.1", "1337", pskInfo));
+  server.stop();
+}
+
 TEST_P(ACTestDTLS, HandleClientDisconnectAndOtherClientConnect) {
   MockIServerNotifier serverNotifier;
   MockIClientNotifier clientNotifier;
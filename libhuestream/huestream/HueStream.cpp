@@ -338,6 +338,18 @@ void HueStream::AddEffect(EffectPtr newEffect) {
     _mixer->AddEffect(newEffect);
 }
 
+void HueStream::AddEffectAsync(EffectPtr newEffect) {
+    // the command is owned and executed by this mixer, so a shared_ptr to it would keep it alive forever
+    auto mixer = _mixer.get();
+    _mixer->Enqueue([mixer, newEffect]() {
+        mixer->AddEffect(newEffect);
+    });
+}
+
+void HueStream::EnqueueMixerCommand(MixerCommand command) {
+    _mixer->Enqueue(std::move(command));
+}
+
 void HueStream::AddLightScript(LightScriptPtr script) {
     auto actions = script->GetActions();
     for (const auto &action : *actions) {
@@ -345,6 +357,23 @@ void HueStream::AddLightScript(LightScriptPtr script) {
     }
 }
 
+void HueStream::AddLightScriptStream(LightScriptStreamPtr stream) {
+    _mixer->Lock();
+    for (const auto &action : *stream->Update()) {
+        _mixer->AddEffect(action);
+    }
+    _lightScriptStreams.push_back(stream);
+    _mixer->Unlock();
+}
+
+void HueStream::SetRenderProfilingEnabled(bool enabled) {
+    _mixer->GetProfiler()->SetEnabled(enabled);
+}
+
+RenderProfilePtr HueStream::GetRenderProfile() {
+    return _mixer->GetProfiler()->GetProfile();
+}
+
 EffectPtr HueStream::GetEffectByName(const std::string &name) {
     return _mixer->GetEffectByName(name);
 }
@@ -397,8 +426,24 @@ void HueStream::UnlockMixer() {
     _mixer->Unlock();
 }
 
+void HueStream::UpdateLightScriptStreams() {
+    auto i = _lightScriptStreams.begin();
+    while (i != _lightScriptStreams.end()) {
+        for (const auto &action : *(*i)->Update()) {
+            _mixer->AddEffect(action);
+        }
+
+        if ((*i)->IsEnded()) {
+            i = _lightScriptStreams.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
 void HueStream::Render() {
     _mixer->Lock();
+    UpdateLightScriptStreams();
     _mixer->Render();
 
     // TODO Update physical light too, so the color matches the one from the channel.
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "huestream/IHueStream.h"
 #include "huestream/config/Config.h"
@@ -28,6 +29,7 @@
 #include "huestream/connect/ConnectionFlow.h"
 #include "huestream/connect/IFeedbackMessageHandler.h"
 #include "huestream/effect/lightscript/LightScript.h"
+#include "huestream/effect/lightscript/LightScriptStream.h"
 #include "huestream/HueStreamFactories.h"
 #include "support/util/Factory.h"
 #include "huestream/common/time/TimeProviderProvider.h"
@@ -312,12 +314,32 @@ class HueStream : public IHueStream {
      */
     void AddEffect(EffectPtr newEffect) override;
 
+    /**
+     add a single effect to the engine without blocking on rendering
+     @note the effect is added at the start of the next render, no LockMixer() needed
+     @param newEffect Reference to effect to be added
+     */
+    void AddEffectAsync(EffectPtr newEffect) override;
+
+    /**
+     queue a change to the engine or its effects without blocking on rendering
+     @note the command is executed by the render thread at the start of the next render, no LockMixer() needed
+     @param command Function making the change, e.g. enabling an effect or changing its properties
+     */
+    void EnqueueMixerCommand(MixerCommand command) override;
+
     /**
      add a full light script to the engine
      @param script Reference to light script to be added
      */
     void AddLightScript(LightScriptPtr script) override;
 
+    void AddLightScriptStream(LightScriptStreamPtr stream) override;
+
+    void SetRenderProfilingEnabled(bool enabled) override;
+
+    RenderProfilePtr GetRenderProfile() override;
+
     /**
      get effect by name
      @param name Name of the effect to retrieve
@@ -443,6 +465,8 @@ class HueStream : public IHueStream {
     virtual void NewFeedbackMessage(const FeedbackMessage &message);
     virtual void Render();
 
+    void UpdateLightScriptStreams();
+
     ConfigPtr _config;
     FeedbackMessageHandlerPtr _handler;
     FeedbackMessageCallback _callback;
@@ -463,6 +487,7 @@ class HueStream : public IHueStream {
     StreamPtr _stream;
     ConnectPtr _connect;
     MixerPtr _mixer;
+    std::vector<LightScriptStreamPtr> _lightScriptStreams;
     ScopedTimeProviderProvider _timeProvider;
 };
 
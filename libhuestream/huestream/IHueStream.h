@@ -22,10 +22,12 @@
 #include "huestream/connect/IMessageDispatcher.h"
 #include "huestream/connect/ConnectionMonitor.h"
 #include "huestream/effect/Mixer.h"
+#include "huestream/effect/RenderProfile.h"
 #include "huestream/stream/Stream.h"
 #include "huestream/connect/ConnectionFlow.h"
 #include "huestream/connect/IFeedbackMessageHandler.h"
 #include "huestream/effect/lightscript/LightScript.h"
+#include "huestream/effect/lightscript/LightScriptStream.h"
 #include "huestream/HueStreamFactories.h"
 #include "support/util/Factory.h"
 
@@ -308,12 +310,47 @@ class IHueStream {
      */
     virtual void AddEffect(EffectPtr newEffect) = 0;
 
+    /**
+     add a single effect to the engine without blocking on rendering
+     @note the effect is added at the start of the next render, no LockMixer() needed
+     @param newEffect Reference to effect to be added
+     */
+    virtual void AddEffectAsync(EffectPtr newEffect) = 0;
+
+    /**
+     queue a change to the engine or its effects without blocking on rendering
+     @note the command is executed by the render thread at the start of the next render, no LockMixer() needed
+     @param command Function making the change, e.g. enabling an effect or changing its properties
+     */
+    virtual void EnqueueMixerCommand(MixerCommand command) = 0;
+
     /**
      add a full light script to the engine
      @param script Reference to light script to be added
      */
     virtual void AddLightScript(LightScriptPtr script) = 0;
 
+    /**
+     play a light script which is loaded incrementally from a binary container file
+     @note the actions of the first lookahead window are added immediately, later actions are added while rendering
+     @param stream Reference to light script stream to be added
+     */
+    virtual void AddLightScriptStream(LightScriptStreamPtr stream) = 0;
+
+    /**
+     enable or disable measuring the render cost of each effect
+     @note disabled by default, costs close to nothing when disabled
+     @param enabled Whether to measure
+     */
+    virtual void SetRenderProfilingEnabled(bool enabled) = 0;
+
+    /**
+     get the render cost of each effect over the last frames which have been rendered with profiling enabled
+     @note use SerializeText() on the result to dump it as JSON
+     @return Render cost per effect name and layer, most expensive first
+     */
+    virtual RenderProfilePtr GetRenderProfile() = 0;
+
     /**
      get effect by name
      @param name Name of the effect to retrieve
@@ -5,6 +5,7 @@
 
 #include <huestream/common/data/Area.h>
 
+#include <limits>
 #include <string>
 #include <vector>
 #include <memory>
@@ -186,6 +187,16 @@ namespace huestream {
         return inArea;
     }
 
+    bool Area::GetBounds(Location *min, Location *max) const {
+        if (_inverted) {
+            return false;
+        }
+
+        *min = Location(_topLeft.GetX(), _bottomRight.GetY(), std::numeric_limits<double>::lowest());
+        *max = Location(_bottomRight.GetX(), _topLeft.GetY(), std::numeric_limits<double>::max());
+        return true;
+    }
+
     std::string Area::GetTypeName() const {
         return type;
     }
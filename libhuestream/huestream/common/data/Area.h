@@ -77,6 +77,8 @@ namespace huestream {
 
         bool isInArea(const Location &location) const override;
 
+        bool GetBounds(Location *min, Location *max) const override;
+
     PROP_DEFINE(Area, Location, topLeft, TopLeft);
     PROP_DEFINE(Area, Location, bottomRight, BottomRight);
     PROP_DEFINE_BOOL(Area, bool, inverted, Inverted);
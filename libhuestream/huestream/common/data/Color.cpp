@@ -93,6 +93,47 @@ void Color::GetYxy(double &Y, double &x, double &y) const {
     y = Y / (X + Y + Z);
 }
 
+static const int GammaTableSize = 1024;
+
+static std::vector<double> CreateGammaTable() {
+    std::vector<double> table(GammaTableSize + 2);
+    for (int i = 0; i <= GammaTableSize; ++i) {
+        double v = static_cast<double>(i) / GammaTableSize;
+        table[i] = (v > 0.04045) ? pow(((v + 0.055) / 1.055), 2.4) : v / 12.92;
+    }
+    table[GammaTableSize + 1] = table[GammaTableSize];
+    return table;
+}
+
+static inline double LinearizeGamma(const double* table, double value) {
+    double pos = value * GammaTableSize;
+    int index = static_cast<int>(pos);
+    double fraction = pos - index;
+    return table[index] + fraction * (table[index + 1] - table[index]);
+}
+
+void Color::RGBToXYBrightness(const double* r, const double* g, const double* b,
+                              double* x, double* y, double* brightness, size_t count) {
+    static const std::vector<double> gammaTable = CreateGammaTable();
+    const double* table = gammaTable.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        double lr = LinearizeGamma(table, r[i]);
+        double lg = LinearizeGamma(table, g[i]);
+        double lb = LinearizeGamma(table, b[i]);
+
+        double X = lr * 0.4124 + lg * 0.3576 + lb * 0.1805;
+        double Y = lr * 0.2126 + lg * 0.7152 + lb * 0.0722;
+        double Z = lr * 0.0193 + lg * 0.1192 + lb * 0.9505;
+
+        double sum = X + Y + Z;
+        double scale = sum > 0.0 ? 1.0 / sum : 0.0;
+        x[i] = X * scale;
+        y[i] = Y * scale;
+        brightness[i] = std::max(std::max(r[i], g[i]), b[i]);
+    }
+}
+
 void Color::GetRawRGB(double& _r, double& _g, double& _b) const {
     _r = _rawRed;
     _g = _rawGreen;
@@ -10,6 +10,7 @@
 #include "huestream/common/serialize/Serializable.h"
 
 #include <stdarg.h>
+#include <stddef.h>
 
 #include <vector>
 #include <string>
@@ -46,6 +47,17 @@ namespace huestream {
 
         void GetRawRGB(double& _r, double& _g, double& _b) const;
 
+        /**
+         convert a batch of clamped sRGB colors to CIE xy chromaticity and brightness
+         @note gamma expansion uses an interpolated lookup table instead of pow(), so the loop has no libm calls
+         @param r, g, b Input arrays of color components between 0 and 1
+         @param x, y Output arrays of CIE xy chromaticity, 0 for black
+         @param brightness Output array of brightness between 0 and 1, i.e. the largest color component
+         @param count Number of colors to convert
+         */
+        static void RGBToXYBrightness(const double* r, const double* g, const double* b,
+                                      double* x, double* y, double* brightness, size_t count);
+
         double GetCurrentBrightness() const;
 
         void ApplyBrightness(double value);
@@ -182,6 +182,16 @@ namespace huestream {
         return inArea;
     }
 
+    bool CuboidArea::GetBounds(Location *min, Location *max) const {
+        if (_inverted) {
+            return false;
+        }
+
+        *min = Location(_topFrontLeft.GetX(), _bottomBackRight.GetY(), _bottomBackRight.GetZ());
+        *max = Location(_bottomBackRight.GetX(), _topFrontLeft.GetY(), _topFrontLeft.GetZ());
+        return true;
+    }
+
     std::string CuboidArea::GetTypeName() const {
         return type;
     }
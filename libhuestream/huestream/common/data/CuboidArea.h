@@ -65,6 +65,8 @@ namespace huestream {
 
         bool isInArea(const Location &location) const override;
 
+        bool GetBounds(Location *min, Location *max) const override;
+
     PROP_DEFINE(CuboidArea, Location, topFrontLeft, TopFrontLeft);
     PROP_DEFINE(CuboidArea, Location, bottomBackRight, BottomBackRight);
     PROP_DEFINE_BOOL(CuboidArea, bool, inverted, Inverted);
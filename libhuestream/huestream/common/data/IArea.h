@@ -26,6 +26,14 @@ namespace huestream {
          check if a location is within this area
          */
         virtual bool isInArea(const Location &location) const = 0;
+
+        /**
+         get a box which contains the whole area, used to look up the lights in this area with a spatial index
+         @return false when the area has no bounds, e.g. when it is inverted
+         */
+        virtual bool GetBounds(Location * /*min*/, Location * /*max*/) const {
+            return false;
+        }
     };
     
     /**
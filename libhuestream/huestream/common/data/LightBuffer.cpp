@@ -0,0 +1,71 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/data/LightBuffer.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    LightBuffer::LightBuffer() : _lights(std::make_shared<LightList>()) {
+    }
+
+    void LightBuffer::Update(const LightListPtr& lights) {
+        _lights = lights;
+
+        const auto count = _lights->size();
+        auto positionsChanged = count != _x.size();
+        _ids.resize(count);
+        _x.resize(count);
+        _y.resize(count);
+        _z.resize(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const auto& light = (*_lights)[i];
+            const auto& position = light->GetPosition();
+            _ids[i] = light->GetId();
+            positionsChanged = positionsChanged ||
+                               _x[i] != position.GetX() || _y[i] != position.GetY() || _z[i] != position.GetZ();
+            _x[i] = position.GetX();
+            _y[i] = position.GetY();
+            _z[i] = position.GetZ();
+        }
+
+        if (positionsChanged) {
+            _spatialIndex.Build(_x.data(), _y.data(), _z.data(), count);
+        }
+    }
+
+    size_t LightBuffer::Size() const {
+        return _x.size();
+    }
+
+    const LightPtr& LightBuffer::GetLight(size_t index) const {
+        return (*_lights)[index];
+    }
+
+    const std::string& LightBuffer::GetId(size_t index) const {
+        return _ids[index];
+    }
+
+    const double* LightBuffer::GetX() const {
+        return _x.data();
+    }
+
+    const double* LightBuffer::GetY() const {
+        return _y.data();
+    }
+
+    const double* LightBuffer::GetZ() const {
+        return _z.data();
+    }
+
+    const SpatialIndex& LightBuffer::GetSpatialIndex() const {
+        return _spatialIndex;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_DATA_LIGHTBUFFER_H_
+#define HUESTREAM_COMMON_DATA_LIGHTBUFFER_H_
+
+#include "huestream/common/data/Light.h"
+#include "huestream/common/data/SpatialIndex.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     structure of arrays copy of the ids and positions of a list of lights
+     @note used to render effects on all lights of a group in one call instead of one call per light
+     */
+    class LightBuffer {
+    public:
+        LightBuffer();
+
+        /**
+         refresh the buffer from a list of lights
+         @note storage is reused, so no allocations are done when the number of lights does not grow
+         @note the spatial index is only rebuilt when the positions of the lights changed
+         */
+        void Update(const LightListPtr& lights);
+
+        size_t Size() const;
+
+        const LightPtr& GetLight(size_t index) const;
+
+        const std::string& GetId(size_t index) const;
+
+        const double* GetX() const;
+
+        const double* GetY() const;
+
+        const double* GetZ() const;
+
+        const SpatialIndex& GetSpatialIndex() const;
+
+    protected:
+        LightListPtr _lights;
+        std::vector<std::string> _ids;
+        std::vector<double> _x;
+        std::vector<double> _y;
+        std::vector<double> _z;
+        SpatialIndex _spatialIndex;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_DATA_LIGHTBUFFER_H_
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/data/SpatialIndex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace huestream {
+
+    SpatialIndex::SpatialIndex() :
+            _minX(0), _minY(0), _maxX(0), _maxY(0),
+            _cellWidth(1), _cellHeight(1),
+            _columns(1), _rows(1),
+            _cellStart(2, 0) {
+    }
+
+    void SpatialIndex::Build(const double* x, const double* y, const double* z, size_t count) {
+        _x.assign(x, x + count);
+        _y.assign(y, y + count);
+        _z.assign(z, z + count);
+
+        if (count == 0) {
+            _columns = _rows = 1;
+            _cellStart.assign(2, 0);
+            _cellLights.clear();
+            return;
+        }
+
+        _minX = *std::min_element(_x.begin(), _x.end());
+        _maxX = *std::max_element(_x.begin(), _x.end());
+        _minY = *std::min_element(_y.begin(), _y.end());
+        _maxY = *std::max_element(_y.begin(), _y.end());
+
+        // aim for about one light per cell
+        auto cellsPerAxis = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+        _columns = _maxX > _minX ? cellsPerAxis : 1;
+        _rows = _maxY > _minY ? cellsPerAxis : 1;
+        _cellWidth = _maxX > _minX ? (_maxX - _minX) / _columns : 1;
+        _cellHeight = _maxY > _minY ? (_maxY - _minY) / _rows : 1;
+
+        // counting sort of the lights by cell
+        _cellStart.assign(_columns * _rows + 1, 0);
+        for (size_t i = 0; i < count; ++i) {
+            _cellStart[GetRow(_y[i]) * _columns + GetColumn(_x[i]) + 1]++;
+        }
+        for (size_t cell = 1; cell < _cellStart.size(); ++cell) {
+            _cellStart[cell] += _cellStart[cell - 1];
+        }
+
+        _cellLights.resize(count);
+        auto next = _cellStart;
+        for (size_t i = 0; i < count; ++i) {
+            _cellLights[next[GetRow(_y[i]) * _columns + GetColumn(_x[i])]++] = i;
+        }
+    }
+
+    size_t SpatialIndex::Size() const {
+        return _x.size();
+    }
+
+    void SpatialIndex::QueryBox(const Location &min, const Location &max, std::vector<size_t>* indices) const {
+        Query(min.GetX(), min.GetY(), max.GetX(), max.GetY(), [&](size_t i) {
+            return _x[i] >= min.GetX() && _x[i] <= max.GetX() &&
+                   _y[i] >= min.GetY() && _y[i] <= max.GetY() &&
+                   _z[i] >= min.GetZ() && _z[i] <= max.GetZ();
+        }, indices);
+    }
+
+    void SpatialIndex::QueryCircle(double x, double y, double radius, std::vector<size_t>* indices) const {
+        const auto radiusSquared = radius * radius;
+        Query(x - radius, y - radius, x + radius, y + radius, [&](size_t i) {
+            auto dx = _x[i] - x;
+            auto dy = _y[i] - y;
+            return dx * dx + dy * dy <= radiusSquared;
+        }, indices);
+    }
+
+    void SpatialIndex::QuerySphere(const Location &center, double radius, std::vector<size_t>* indices) const {
+        const auto radiusSquared = radius * radius;
+        Query(center.GetX() - radius, center.GetY() - radius, center.GetX() + radius, center.GetY() + radius,
+              [&](size_t i) {
+            auto dx = _x[i] - center.GetX();
+            auto dy = _y[i] - center.GetY();
+            auto dz = _z[i] - center.GetZ();
+            return dx * dx + dy * dy + dz * dz <= radiusSquared;
+        }, indices);
+    }
+
+    size_t SpatialIndex::GetColumn(double x) const {
+        auto column = (x - _minX) / _cellWidth;
+        return column <= 0 ? 0 : std::min(static_cast<size_t>(column), _columns - 1);
+    }
+
+    size_t SpatialIndex::GetRow(double y) const {
+        auto row = (y - _minY) / _cellHeight;
+        return row <= 0 ? 0 : std::min(static_cast<size_t>(row), _rows - 1);
+    }
+
+    template<typename Predicate>
+    void SpatialIndex::Query(double minX, double minY, double maxX, double maxY, Predicate predicate,
+                             std::vector<size_t>* indices) const {
+        if (_x.empty() || maxX < _minX || minX > _maxX || maxY < _minY || minY > _maxY) {
+            return;
+        }
+
+        const auto firstColumn = GetColumn(minX);
+        const auto lastColumn = GetColumn(maxX);
+        const auto lastRow = GetRow(maxY);
+        for (auto row = GetRow(minY); row <= lastRow; ++row) {
+            const auto begin = _cellStart[row * _columns + firstColumn];
+            const auto end = _cellStart[row * _columns + lastColumn + 1];
+            for (auto cell = begin; cell < end; ++cell) {
+                const auto i = _cellLights[cell];
+                if (predicate(i)) {
+                    indices->push_back(i);
+                }
+            }
+        }
+    }
+
+}  // namespace huestream
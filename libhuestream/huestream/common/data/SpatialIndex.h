@@ -0,0 +1,73 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_DATA_SPATIALINDEX_H_
+#define HUESTREAM_COMMON_DATA_SPATIALINDEX_H_
+
+#include "huestream/common/data/Location.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace huestream {
+
+    /**
+     uniform grid over the x and y position of a set of lights
+     @note queries append the indices of the lights which are inside the queried shape, so the cost of a query scales with the number of lights near the shape instead of the total number of lights
+     */
+    class SpatialIndex {
+    public:
+        SpatialIndex();
+
+        /**
+         rebuild the index for a set of positions
+         @note indices returned by queries refer to the position in these arrays
+         */
+        void Build(const double* x, const double* y, const double* z, size_t count);
+
+        size_t Size() const;
+
+        /**
+         find all lights with a position within the box spanned by min and max (inclusive)
+         */
+        void QueryBox(const Location &min, const Location &max, std::vector<size_t>* indices) const;
+
+        /**
+         find all lights within a radius of a center on the x, y plane, ignoring z
+         */
+        void QueryCircle(double x, double y, double radius, std::vector<size_t>* indices) const;
+
+        /**
+         find all lights within a radius of a center
+         */
+        void QuerySphere(const Location &center, double radius, std::vector<size_t>* indices) const;
+
+    protected:
+        size_t GetColumn(double x) const;
+        size_t GetRow(double y) const;
+
+        template<typename Predicate>
+        void Query(double minX, double minY, double maxX, double maxY, Predicate predicate,
+                   std::vector<size_t>* indices) const;
+
+        std::vector<double> _x;
+        std::vector<double> _y;
+        std::vector<double> _z;
+        double _minX;
+        double _minY;
+        double _maxX;
+        double _maxY;
+        double _cellWidth;
+        double _cellHeight;
+        size_t _columns;
+        size_t _rows;
+        std::vector<size_t> _cellStart;
+        std::vector<size_t> _cellLights;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_DATA_SPATIALINDEX_H_
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/serialize/BinaryNode.h>
+
+#include <string.h>
+
+#include <string>
+
+namespace huestream {
+
+    const char BinaryNode::Magic[4] = {'H', 'S', 'B', 'C'};
+
+    static JSONNode CreateNullJson() {
+        JSONNode node;
+        node.nullify();
+        return node;
+    }
+
+    BinaryNode BinaryNode::Open(const void *data, size_t size) {
+        auto bytes = static_cast<const uint8_t *>(data);
+        if (bytes == nullptr || size < sizeof(Header) || reinterpret_cast<uintptr_t>(bytes) % sizeof(double) != 0) {
+            return BinaryNode();
+        }
+
+        Header header;
+        memcpy(&header, bytes, sizeof(Header));
+        if (memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.versionMajor != VersionMajor ||
+            header.byteOrder != ByteOrder || header.size > size) {
+            return BinaryNode();
+        }
+
+        auto root = BinaryNode(bytes, static_cast<size_t>(header.size), header.root, Kind::Node, 0);
+        if (!root.Contains(header.stringTable, static_cast<uint64_t>(header.stringCount) * sizeof(uint64_t)) ||
+            root.GetType() == Type::Invalid) {
+            return BinaryNode();
+        }
+        return root;
+    }
+
+    BinaryNode::BinaryNode() : _data(nullptr), _size(0), _offset(0), _kind(Kind::Node), _index(0) {
+    }
+
+    BinaryNode::BinaryNode(const uint8_t *data, size_t size, uint64_t offset, Kind kind, uint32_t index)
+        : _data(data), _size(size), _offset(offset), _kind(kind), _index(index) {
+    }
+
+    BinaryNode::Type BinaryNode::GetType() const {
+        if (_data == nullptr || !Contains(_offset, NodeHeaderSize)) {
+            return Type::Invalid;
+        }
+
+        switch (_kind) {
+            case Kind::Element:
+                return Type::Number;
+            case Kind::Row:
+                return Type::Object;
+            case Kind::Cell:
+                return Read<uint32_t>(_offset + 4) == ColumnNumbers ? Type::Number : Type::String;
+            case Kind::Node:
+                break;
+        }
+
+        switch (GetTag()) {
+            case TagNull:
+                return Type::Null;
+            case TagBool:
+                return Type::Bool;
+            case TagNumber:
+                return Contains(_offset + NodeHeaderSize, sizeof(double)) ? Type::Number : Type::Invalid;
+            case TagString:
+                return Type::String;
+            case TagArray:
+                return Contains(_offset + NodeHeaderSize, static_cast<uint64_t>(GetCount()) * sizeof(uint64_t))
+                       ? Type::Array : Type::Invalid;
+            case TagObject:
+                return Contains(_offset + NodeHeaderSize, static_cast<uint64_t>(GetCount()) * EntrySize)
+                       ? Type::Object : Type::Invalid;
+            case TagNumbers:
+                return GetPackedDoubles(_offset + NodeHeaderSize, GetCount()) != nullptr ? Type::Array : Type::Invalid;
+            case TagTable:
+                return IsValidTable() ? Type::Array : Type::Invalid;
+            default:
+                return Type::Invalid;
+        }
+    }
+
+    bool BinaryNode::IsValid() const {
+        return GetType() != Type::Invalid;
+    }
+
+    size_t BinaryNode::Size() const {
+        switch (GetType()) {
+            case Type::Array:
+                return GetCount();
+            case Type::Object:
+                return _kind == Kind::Row ? Read<uint32_t>(_offset + NodeHeaderSize) : GetCount();
+            default:
+                return 0;
+        }
+    }
+
+    BinaryNode BinaryNode::At(size_t index) const {
+        if (index >= Size()) {
+            return BinaryNode();
+        }
+
+        auto payload = _offset + NodeHeaderSize;
+        if (_kind == Kind::Row) {
+            auto column = payload + sizeof(uint64_t) + index * EntrySize;
+            return BinaryNode(_data, _size, column, Kind::Cell, _index);
+        }
+
+        switch (GetTag()) {
+            case TagArray:
+                return BinaryNode(_data, _size, Read<uint64_t>(payload + index * sizeof(uint64_t)), Kind::Node, 0);
+            case TagObject:
+                return BinaryNode(_data, _size, Read<uint64_t>(payload + index * EntrySize + 8), Kind::Node, 0);
+            case TagNumbers:
+                return BinaryNode(_data, _size, _offset, Kind::Element, static_cast<uint32_t>(index));
+            case TagTable:
+                return BinaryNode(_data, _size, _offset, Kind::Row, static_cast<uint32_t>(index));
+            default:
+                return BinaryNode();
+        }
+    }
+
+    const char *BinaryNode::GetName(size_t index) const {
+        if (GetType() != Type::Object || index >= Size()) {
+            return nullptr;
+        }
+
+        auto payload = _offset + NodeHeaderSize;
+        if (_kind == Kind::Row) {
+            return GetString(Read<uint32_t>(payload + sizeof(uint64_t) + index * EntrySize));
+        }
+        return GetString(Read<uint32_t>(payload + index * EntrySize));
+    }
+
+    BinaryNode BinaryNode::Find(const std::string &name) const {
+        auto size = Size();
+        for (size_t i = 0; i < size; ++i) {
+            auto childName = GetName(i);
+            if (childName != nullptr && name == childName) {
+                return At(i);
+            }
+        }
+        return BinaryNode();
+    }
+
+    bool BinaryNode::AsBool() const {
+        return GetType() == Type::Bool && GetCount() != 0;
+    }
+
+    double BinaryNode::AsNumber() const {
+        if (GetType() != Type::Number) {
+            return 0;
+        }
+
+        const double *values = nullptr;
+        switch (_kind) {
+            case Kind::Element:
+                values = GetPackedDoubles(_offset + NodeHeaderSize, GetCount());
+                break;
+            case Kind::Cell:
+                values = GetPackedDoubles(Read<uint64_t>(_offset + 8), _index + 1);
+                break;
+            default:
+                return Read<double>(_offset + NodeHeaderSize);
+        }
+        return values != nullptr ? values[_index] : 0;
+    }
+
+    const char *BinaryNode::AsString() const {
+        if (GetType() != Type::String) {
+            return "";
+        }
+
+        auto value = GetString(_kind == Kind::Cell ? static_cast<uint32_t>(Read<uint64_t>(_offset + 8)) : GetCount());
+        return value != nullptr ? value : "";
+    }
+
+    const double *BinaryNode::GetNumbers() const {
+        if (_kind != Kind::Node || GetType() != Type::Array || GetTag() != TagNumbers) {
+            return nullptr;
+        }
+        return GetPackedDoubles(_offset + NodeHeaderSize, GetCount());
+    }
+
+    const double *BinaryNode::GetColumn(const std::string &name) const {
+        if (_kind != Kind::Node || GetType() != Type::Array || GetTag() != TagTable) {
+            return nullptr;
+        }
+
+        auto row = At(0);
+        auto columnCount = row.Size();
+        for (size_t i = 0; i < columnCount; ++i) {
+            auto columnName = row.GetName(i);
+            auto column = row.At(i);
+            if (columnName != nullptr && name == columnName && column.GetType() == Type::Number) {
+                return GetPackedDoubles(Read<uint64_t>(column._offset + 8), GetCount());
+            }
+        }
+        return nullptr;
+    }
+
+    JSONNode BinaryNode::ToJson() const {
+        return ToJson(0, sizeof(Header) - 1);
+    }
+
+    JSONNode BinaryNode::ToJson(int depth, uint64_t lowerBound) const {
+        auto type = GetType();
+        switch (type) {
+            case Type::Bool:
+                return JSONNode("", AsBool());
+            case Type::Number:
+                return JSONNode("", AsNumber());
+            case Type::String:
+                return JSONNode("", std::string(AsString()));
+            case Type::Array:
+            case Type::Object: {
+                JSONNode node(type == Type::Array ? JSON_ARRAY : JSON_NODE);
+                auto size = depth < MaxDepth ? Size() : 0;
+                for (size_t i = 0; i < size; ++i) {
+                    // children are written in order before their parent, so valid subtrees never overlap
+                    auto child = At(i);
+                    auto childNode = CreateNullJson();
+                    if (child._kind != Kind::Node) {
+                        childNode = child.ToJson(depth + 1, lowerBound);
+                    } else if (child._offset > lowerBound && child._offset < _offset) {
+                        childNode = child.ToJson(depth + 1, lowerBound);
+                        lowerBound = child._offset;
+                    }
+
+                    if (type == Type::Object) {
+                        auto name = GetName(i);
+                        childNode.set_name(name != nullptr ? name : "");
+                    }
+                    node.push_back(childNode);
+                }
+                return node;
+            }
+            default:
+                return CreateNullJson();
+        }
+    }
+
+    bool BinaryNode::IsValidTable() const {
+        auto payload = _offset + NodeHeaderSize;
+        if (!Contains(payload, sizeof(uint64_t))) {
+            return false;
+        }
+
+        auto columnCount = Read<uint32_t>(payload);
+        if (!Contains(payload + sizeof(uint64_t), static_cast<uint64_t>(columnCount) * EntrySize)) {
+            return false;
+        }
+
+        auto hasNumbers = false;
+        for (uint32_t i = 0; i < columnCount; ++i) {
+            auto entry = payload + sizeof(uint64_t) + i * EntrySize;
+            auto kind = Read<uint32_t>(entry + 4);
+            if (kind == ColumnNumbers) {
+                if (GetPackedDoubles(Read<uint64_t>(entry + 8), GetCount()) == nullptr) {
+                    return false;
+                }
+                hasNumbers = true;
+            } else if (kind != ColumnString) {
+                return false;
+            }
+        }
+        return hasNumbers;
+    }
+
+    bool BinaryNode::Contains(uint64_t offset, uint64_t length) const {
+        return offset <= _size && length <= _size - offset;
+    }
+
+    template<typename T>
+    T BinaryNode::Read(uint64_t offset) const {
+        T value;
+        memcpy(&value, _data + offset, sizeof(T));
+        return value;
+    }
+
+    uint32_t BinaryNode::GetTag() const {
+        return Read<uint32_t>(_offset);
+    }
+
+    uint32_t BinaryNode::GetCount() const {
+        return Read<uint32_t>(_offset + 4);
+    }
+
+    const char *BinaryNode::GetString(uint32_t index) const {
+        Header header;
+        memcpy(&header, _data, sizeof(Header));
+        if (index >= header.stringCount) {
+            return nullptr;
+        }
+
+        auto offset = Read<uint64_t>(header.stringTable + static_cast<uint64_t>(index) * sizeof(uint64_t));
+        if (!Contains(offset, sizeof(uint32_t))) {
+            return nullptr;
+        }
+
+        auto length = Read<uint32_t>(offset);
+        auto value = offset + sizeof(uint32_t);
+        if (!Contains(value, static_cast<uint64_t>(length) + 1) || _data[value + length] != '\0') {
+            return nullptr;
+        }
+        return reinterpret_cast<const char *>(_data + value);
+    }
+
+    const double *BinaryNode::GetPackedDoubles(uint64_t offset, uint32_t count) const {
+        if (offset % sizeof(double) != 0 || !Contains(offset, static_cast<uint64_t>(count) * sizeof(double))) {
+            return nullptr;
+        }
+        return reinterpret_cast<const double *>(_data + offset);
+    }
+
+}  // namespace huestream
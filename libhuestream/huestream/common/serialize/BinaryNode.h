@@ -0,0 +1,174 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_SERIALIZE_BINARYNODE_H_
+#define HUESTREAM_COMMON_SERIALIZE_BINARYNODE_H_
+
+#include "libjson/libjson.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace huestream {
+
+    /**
+     read-only view on a node in a binary container, which can be used directly on a memory mapped file without copying
+     @note the binary container is a versioned and 8 byte aligned encoding of the JSON tree made by Serializable::Serialize()
+     @note numeric arrays and lists of objects with equal attributes (such as curve points) are stored as packed columns of doubles
+     @see BinaryWriter
+     */
+    class BinaryNode {
+    public:
+        enum class Type {
+            Invalid,
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        static constexpr uint16_t VersionMajor = 1;
+        static constexpr uint16_t VersionMinor = 0;
+
+        /**
+         get the root node of a binary container
+         @param data Start of the container, must be 8 byte aligned
+         @param size Size of the container in bytes
+         @return root node, or an invalid node if the data is not a compatible binary container
+         */
+        static BinaryNode Open(const void *data, size_t size);
+
+        BinaryNode();
+
+        Type GetType() const;
+
+        bool IsValid() const;
+
+        /**
+         get number of elements of an array or number of attributes of an object
+         */
+        size_t Size() const;
+
+        /**
+         get element of an array or attribute value of an object
+         @return invalid node if out of range
+         */
+        BinaryNode At(size_t index) const;
+
+        /**
+         get attribute name of an object
+         @return nullptr if out of range
+         */
+        const char *GetName(size_t index) const;
+
+        /**
+         get first attribute value of an object with a certain name
+         @return invalid node if there is no such attribute
+         */
+        BinaryNode Find(const std::string &name) const;
+
+        bool AsBool() const;
+
+        double AsNumber() const;
+
+        /**
+         get zero terminated string
+         @return pointer into the container, or an empty string if this is not a string node
+         */
+        const char *AsString() const;
+
+        /**
+         get packed values of an array which only contains numbers
+         @return pointer into the container with Size() values, or nullptr if the array is not packed
+         */
+        const double *GetNumbers() const;
+
+        /**
+         get packed values of a numeric attribute of all objects in an array
+         @return pointer into the container with Size() values, or nullptr if the array is not packed or has no such numeric attribute
+         */
+        const double *GetColumn(const std::string &name) const;
+
+        /**
+         convert this node and all its children to JSON
+         */
+        JSONNode ToJson() const;
+
+    private:
+        friend class BinaryWriter;
+
+        enum Tag : uint32_t {
+            TagNull,
+            TagBool,
+            TagNumber,
+            TagString,
+            TagArray,
+            TagObject,
+            TagNumbers,
+            TagTable
+        };
+
+        enum ColumnKind : uint32_t {
+            ColumnNumbers,
+            ColumnString
+        };
+
+        struct Header {
+            char magic[4];
+            uint16_t versionMajor;
+            uint16_t versionMinor;
+            uint32_t byteOrder;
+            uint32_t stringCount;
+            uint64_t stringTable;
+            uint64_t root;
+            uint64_t size;
+        };
+
+        static const char Magic[4];
+        static constexpr uint32_t ByteOrder = 0x01020304;
+        static constexpr size_t NodeHeaderSize = 8;
+        static constexpr size_t EntrySize = 16;
+        static constexpr int MaxDepth = 128;
+
+        enum class Kind {
+            Node,
+            Element,
+            Row,
+            Cell
+        };
+
+        BinaryNode(const uint8_t *data, size_t size, uint64_t offset, Kind kind, uint32_t index);
+
+        JSONNode ToJson(int depth, uint64_t lowerBound) const;
+
+        bool IsValidTable() const;
+
+        bool Contains(uint64_t offset, uint64_t length) const;
+
+        template<typename T>
+        T Read(uint64_t offset) const;
+
+        uint32_t GetTag() const;
+
+        uint32_t GetCount() const;
+
+        const char *GetString(uint32_t index) const;
+
+        const double *GetPackedDoubles(uint64_t offset, uint32_t count) const;
+
+        const uint8_t *_data;
+        size_t _size;
+        uint64_t _offset;
+        Kind _kind;
+        uint32_t _index;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_SERIALIZE_BINARYNODE_H_
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/serialize/BinaryWriter.h>
+#include <huestream/common/serialize/BinaryNode.h>
+
+#include <string.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace huestream {
+
+    std::vector<uint8_t> BinaryWriter::Write(const JSONNode &node) {
+        BinaryWriter writer;
+        auto headerOffset = writer.Allocate(sizeof(BinaryNode::Header));
+        auto root = writer.WriteNode(node);
+        auto stringTable = writer.WriteStrings();
+
+        BinaryNode::Header header;
+        memcpy(header.magic, BinaryNode::Magic, sizeof(header.magic));
+        header.versionMajor = BinaryNode::VersionMajor;
+        header.versionMinor = BinaryNode::VersionMinor;
+        header.byteOrder = BinaryNode::ByteOrder;
+        header.stringCount = static_cast<uint32_t>(writer._strings.size());
+        header.stringTable = stringTable;
+        header.root = root;
+        header.size = writer._data.size();
+        writer.Put(headerOffset, header);
+
+        return std::move(writer._data);
+    }
+
+    BinaryWriter::BinaryWriter() {
+    }
+
+    uint64_t BinaryWriter::WriteNode(const JSONNode &node) {
+        switch (node.type()) {
+            case JSON_BOOL:
+                return AllocateNode(BinaryNode::TagBool, node.as_bool() ? 1 : 0, 0);
+            case JSON_NUMBER: {
+                auto offset = AllocateNode(BinaryNode::TagNumber, 0, sizeof(double));
+                Put<double>(offset + BinaryNode::NodeHeaderSize, node.as_float());
+                return offset;
+            }
+            case JSON_STRING:
+                return AllocateNode(BinaryNode::TagString, AddString(node.as_string()), 0);
+            case JSON_ARRAY:
+                if (IsNumberArray(node)) {
+                    return WriteNumbers(node);
+                }
+                if (IsTable(node)) {
+                    return WriteTable(node);
+                }
+                return WriteArray(node);
+            case JSON_NODE:
+                return WriteObject(node);
+            default:
+                return AllocateNode(BinaryNode::TagNull, 0, 0);
+        }
+    }
+
+    uint64_t BinaryWriter::WriteArray(const JSONNode &node) {
+        std::vector<uint64_t> children;
+        children.reserve(node.size());
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            children.push_back(WriteNode(*it));
+        }
+
+        auto offset = AllocateNode(BinaryNode::TagArray, static_cast<uint32_t>(children.size()),
+                                   children.size() * sizeof(uint64_t));
+        for (size_t i = 0; i < children.size(); ++i) {
+            Put(offset + BinaryNode::NodeHeaderSize + i * sizeof(uint64_t), children[i]);
+        }
+        return offset;
+    }
+
+    uint64_t BinaryWriter::WriteObject(const JSONNode &node) {
+        std::vector<std::pair<uint32_t, uint64_t>> children;
+        children.reserve(node.size());
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            children.emplace_back(AddString(it->name()), WriteNode(*it));
+        }
+
+        auto offset = AllocateNode(BinaryNode::TagObject, static_cast<uint32_t>(children.size()),
+                                   children.size() * BinaryNode::EntrySize);
+        for (size_t i = 0; i < children.size(); ++i) {
+            auto entry = offset + BinaryNode::NodeHeaderSize + i * BinaryNode::EntrySize;
+            Put(entry, children[i].first);
+            Put(entry + 8, children[i].second);
+        }
+        return offset;
+    }
+
+    uint64_t BinaryWriter::WriteNumbers(const JSONNode &node) {
+        auto count = node.size();
+        auto offset = AllocateNode(BinaryNode::TagNumbers, static_cast<uint32_t>(count), count * sizeof(double));
+        auto i = 0;
+        for (auto it = node.begin(); it != node.end(); ++it, ++i) {
+            Put<double>(offset + BinaryNode::NodeHeaderSize + i * sizeof(double), it->as_float());
+        }
+        return offset;
+    }
+
+    uint64_t BinaryWriter::WriteTable(const JSONNode &node) {
+        auto rows = node.size();
+        const auto &first = node[0];
+        auto columns = first.size();
+
+        std::vector<uint64_t> values(columns);
+        for (size_t column = 0; column < columns; ++column) {
+            if (first[column].type() == JSON_STRING) {
+                values[column] = AddString(first[column].as_string());
+                continue;
+            }
+
+            values[column] = Allocate(rows * sizeof(double));
+            for (size_t row = 0; row < rows; ++row) {
+                Put<double>(values[column] + row * sizeof(double), node[row][column].as_float());
+            }
+        }
+
+        auto offset = AllocateNode(BinaryNode::TagTable, static_cast<uint32_t>(rows),
+                                   sizeof(uint64_t) + columns * BinaryNode::EntrySize);
+        Put(offset + BinaryNode::NodeHeaderSize, static_cast<uint32_t>(columns));
+        for (size_t column = 0; column < columns; ++column) {
+            auto entry = offset + BinaryNode::NodeHeaderSize + sizeof(uint64_t) + column * BinaryNode::EntrySize;
+            Put(entry, AddString(first[column].name()));
+            Put<uint32_t>(entry + 4, first[column].type() == JSON_STRING ? BinaryNode::ColumnString
+                                                                        : BinaryNode::ColumnNumbers);
+            Put(entry + 8, values[column]);
+        }
+        return offset;
+    }
+
+    uint64_t BinaryWriter::WriteStrings() {
+        auto table = Allocate(_strings.size() * sizeof(uint64_t));
+        for (size_t i = 0; i < _strings.size(); ++i) {
+            const auto &value = _strings[i];
+            auto offset = Allocate(sizeof(uint32_t) + value.size() + 1);
+            Put(offset, static_cast<uint32_t>(value.size()));
+            memcpy(_data.data() + offset + sizeof(uint32_t), value.data(), value.size());
+            Put(table + i * sizeof(uint64_t), offset);
+        }
+        return table;
+    }
+
+    uint64_t BinaryWriter::Allocate(size_t length) {
+        auto offset = (_data.size() + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+        _data.resize(offset + length, 0);
+        return offset;
+    }
+
+    uint64_t BinaryWriter::AllocateNode(uint32_t tag, uint32_t count, size_t payloadLength) {
+        auto offset = Allocate(BinaryNode::NodeHeaderSize + payloadLength);
+        Put(offset, tag);
+        Put(offset + 4, count);
+        return offset;
+    }
+
+    uint32_t BinaryWriter::AddString(const std::string &value) {
+        auto it = _stringIndices.find(value);
+        if (it != _stringIndices.end()) {
+            return it->second;
+        }
+
+        auto index = static_cast<uint32_t>(_strings.size());
+        _strings.push_back(value);
+        _stringIndices[value] = index;
+        return index;
+    }
+
+    template<typename T>
+    void BinaryWriter::Put(uint64_t offset, const T &value) {
+        memcpy(_data.data() + offset, &value, sizeof(T));
+    }
+
+    bool BinaryWriter::IsNumberArray(const JSONNode &node) {
+        if (node.empty()) {
+            return false;
+        }
+
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            if (it->type() != JSON_NUMBER) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool BinaryWriter::IsTable(const JSONNode &node) {
+        if (node.size() < 2 || node[0].type() != JSON_NODE || node[0].empty()) {
+            return false;
+        }
+
+        const auto &first = node[0];
+        auto hasNumbers = false;
+        for (auto it = first.begin(); it != first.end(); ++it) {
+            hasNumbers = hasNumbers || it->type() == JSON_NUMBER;
+        }
+        if (!hasNumbers) {
+            return false;
+        }
+
+        for (auto it = node.begin(); it != node.end(); ++it) {
+            if (it->type() != JSON_NODE || it->size() != first.size()) {
+                return false;
+            }
+
+            for (size_t column = 0; column < first.size(); ++column) {
+                const auto &cell = (*it)[column];
+                const auto &firstCell = first[column];
+                if (cell.name() != firstCell.name() || cell.type() != firstCell.type()) {
+                    return false;
+                }
+                if (cell.type() == JSON_STRING && cell.as_string() != firstCell.as_string()) {
+                    return false;
+                }
+                if (cell.type() != JSON_STRING && cell.type() != JSON_NUMBER) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_SERIALIZE_BINARYWRITER_H_
+#define HUESTREAM_COMMON_SERIALIZE_BINARYWRITER_H_
+
+#include "libjson/libjson.h"
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     converts a JSON tree into the binary container format which can be read by huestream::BinaryNode
+     */
+    class BinaryWriter {
+    public:
+        /**
+         convert JSON tree into a binary container
+         @param node Root of the JSON tree, normally made by Serializable::Serialize()
+         @return binary container
+         */
+        static std::vector<uint8_t> Write(const JSONNode &node);
+
+    private:
+        BinaryWriter();
+
+        uint64_t WriteNode(const JSONNode &node);
+
+        uint64_t WriteArray(const JSONNode &node);
+
+        uint64_t WriteObject(const JSONNode &node);
+
+        uint64_t WriteNumbers(const JSONNode &node);
+
+        uint64_t WriteTable(const JSONNode &node);
+
+        uint64_t WriteStrings();
+
+        uint64_t Allocate(size_t length);
+
+        uint64_t AllocateNode(uint32_t tag, uint32_t count, size_t payloadLength);
+
+        uint32_t AddString(const std::string &value);
+
+        template<typename T>
+        void Put(uint64_t offset, const T &value);
+
+        static bool IsNumberArray(const JSONNode &node);
+
+        static bool IsTable(const JSONNode &node);
+
+        std::vector<uint8_t> _data;
+        std::vector<std::string> _strings;
+        std::map<std::string, uint32_t> _stringIndices;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_SERIALIZE_BINARYWRITER_H_
@@ -107,7 +107,7 @@ namespace huestream {
             if (!SerializerHelper::IsAttributeSet(node, attribute_name))
                 return default_value;
 
-            JSONNode c = (*node)[attribute_name];
+            JSONNode &c = (*node)[attribute_name];
             auto value = std::static_pointer_cast<T>(DeserializeFromJson(&c));
             if (value == nullptr)
                 return default_value;
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/storage/BinaryFileStorageAccessor.h>
+#include <huestream/common/storage/MappedFile.h>
+#include <huestream/common/serialize/BinaryNode.h>
+#include <huestream/common/serialize/BinaryWriter.h>
+
+#include <fstream>
+#include <string>
+#include <codecvt>
+#include <locale>
+
+namespace huestream {
+
+    BinaryFileStorageAccessor::BinaryFileStorageAccessor(const std::string &fileName) : _fileName(fileName) {
+    }
+
+    void BinaryFileStorageAccessor::Load(LoadCallbackHandler cb) {
+        MappedFile file(_fileName);
+        auto root = BinaryNode::Open(file.GetData(), file.GetSize());
+        if (!root.IsValid()) {
+            cb(OPERATION_FAILED, nullptr);
+            return;
+        }
+
+        auto node = root.ToJson();
+        auto s = Serializable::DeserializeFromJson(&node);
+        cb(s != nullptr ? OPERATION_SUCCESS : OPERATION_FAILED, s);
+    }
+
+    void BinaryFileStorageAccessor::Save(SerializablePtr serializable, SaveCallbackHandler cb) {
+        JSONNode node;
+        serializable->Serialize(&node);
+        auto data = BinaryWriter::Write(node);
+
+        std::ofstream file;
+#ifdef WIN32
+        // We need to use the wstring version of this function otherwise if the file name contain non ascii char, it will fail on Windows
+        file.open(std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>>().from_bytes(_fileName),
+                  std::fstream::out | std::fstream::trunc | std::fstream::binary);
+#else
+        file.open(_fileName.c_str(), std::fstream::out | std::fstream::trunc | std::fstream::binary);
+#endif
+        if (file.is_open()) {
+            file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+            file.close();
+            cb(file.fail() ? OPERATION_FAILED : OPERATION_SUCCESS);
+        } else {
+            cb(OPERATION_FAILED);
+        }
+    }
+}  // namespace huestream
@@ -0,0 +1,34 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_STORAGE_BINARYFILESTORAGEACCESSOR_H_
+#define HUESTREAM_COMMON_STORAGE_BINARYFILESTORAGEACCESSOR_H_
+
+#include "huestream/common/storage/IStorageAccessor.h"
+
+#include <string>
+
+namespace huestream {
+
+    /**
+     storage accessor which stores serializable objects such as a huestream::LightScript in the binary container format
+     @note the file is memory mapped while loading, so no text is parsed
+     @see BinaryNode
+     */
+    class BinaryFileStorageAccessor : public IStorageAccessor {
+    public:
+        explicit BinaryFileStorageAccessor(const std::string &fileName);
+
+        void Load(LoadCallbackHandler cb) override;
+
+        void Save(SerializablePtr serializable, SaveCallbackHandler cb) override;
+
+    private:
+        std::string _fileName;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_STORAGE_BINARYFILESTORAGEACCESSOR_H_
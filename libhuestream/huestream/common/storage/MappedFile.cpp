@@ -0,0 +1,98 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/storage/MappedFile.h>
+
+#ifdef WIN32
+#include <windows.h>
+#include <codecvt>
+#include <locale>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+namespace huestream {
+
+#ifdef WIN32
+    MappedFile::MappedFile(const std::string &fileName)
+        : _data(nullptr), _size(0), _file(INVALID_HANDLE_VALUE), _mapping(nullptr) {
+        // We need to use the wstring version of this function otherwise if the file name contain non ascii char, it will fail on Windows
+        auto wideFileName = std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>>().from_bytes(fileName);
+        _file = CreateFileW(wideFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(_file, &size) || size.QuadPart == 0) {
+            return;
+        }
+
+        _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping == nullptr) {
+            return;
+        }
+
+        _data = static_cast<const uint8_t *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (_data != nullptr) {
+            _size = static_cast<size_t>(size.QuadPart);
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        if (_data != nullptr) {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping != nullptr) {
+            CloseHandle(_mapping);
+        }
+        if (_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(_file);
+        }
+    }
+#else
+    MappedFile::MappedFile(const std::string &fileName) : _data(nullptr), _size(0) {
+        auto fd = open(fileName.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat status;
+        if (fstat(fd, &status) == 0 && status.st_size > 0) {
+            auto data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                _data = static_cast<const uint8_t *>(data);
+                _size = static_cast<size_t>(status.st_size);
+            }
+        }
+        close(fd);
+    }
+
+    MappedFile::~MappedFile() {
+        if (_data != nullptr) {
+            munmap(const_cast<uint8_t *>(_data), _size);
+        }
+    }
+#endif
+
+    bool MappedFile::IsOpen() const {
+        return _data != nullptr;
+    }
+
+    const uint8_t *MappedFile::GetData() const {
+        return _data;
+    }
+
+    size_t MappedFile::GetSize() const {
+        return _size;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_STORAGE_MAPPEDFILE_H_
+#define HUESTREAM_COMMON_STORAGE_MAPPEDFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace huestream {
+
+    /**
+     read-only memory mapping of a whole file, which stays valid as long as this object exists
+     */
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string &fileName);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /**
+         check whether the file could be opened and mapped
+         @note empty files can not be mapped
+         */
+        bool IsOpen() const;
+
+        const uint8_t *GetData() const;
+
+        size_t GetSize() const;
+
+    private:
+        const uint8_t *_data;
+        size_t _size;
+#ifdef WIN32
+        void *_file;
+        void *_mapping;
+#endif
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_STORAGE_MAPPEDFILE_H_
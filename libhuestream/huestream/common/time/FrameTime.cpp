@@ -0,0 +1,31 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/time/FrameTime.h>
+#include <huestream/common/time/TimeProviderProvider.h>
+
+namespace huestream {
+
+    static thread_local int64_t frameNow = 0;
+    static thread_local bool frameActive = false;
+
+    FrameTime::Scope::Scope(int64_t now) : _previousNow(frameNow), _previousActive(frameActive) {
+        frameNow = now;
+        frameActive = true;
+    }
+
+    FrameTime::Scope::~Scope() {
+        frameNow = _previousNow;
+        frameActive = _previousActive;
+    }
+
+    int64_t FrameTime::Now() {
+        if (frameActive) {
+            return frameNow;
+        }
+        return TimeProviderProvider::get()->Now();
+    }
+
+}  // namespace huestream
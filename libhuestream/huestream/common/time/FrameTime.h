@@ -0,0 +1,49 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_TIME_FRAMETIME_H_
+#define HUESTREAM_COMMON_TIME_FRAMETIME_H_
+
+#include <stdint.h>
+
+namespace huestream {
+
+    /**
+     time stamp of the frame which is being rendered on the current thread
+     @note sampled once per frame by the mixer, so all players of all effects in a frame see the same time without looking up the time provider
+     */
+    class FrameTime {
+    public:
+        /**
+         makes Now() return a fixed time stamp on the current thread for as long as it exists
+         */
+        class Scope {
+        public:
+            explicit Scope(int64_t now);
+
+            ~Scope();
+
+            Scope(const Scope &) = delete;
+
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            int64_t _previousNow;
+            bool _previousActive;
+        };
+
+        /**
+         get the time stamp of the current frame
+         @return frame time if called within a Scope, otherwise the current time of the TimeProviderProvider
+         */
+        static int64_t Now();
+
+    private:
+        FrameTime() = delete;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_TIME_FRAMETIME_H_
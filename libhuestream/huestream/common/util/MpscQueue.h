@@ -0,0 +1,78 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_COMMON_UTIL_MPSCQUEUE_H_
+#define HUESTREAM_COMMON_UTIL_MPSCQUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+namespace huestream {
+
+    /**
+     unbounded lock-free queue for multiple producer threads and a single consumer thread
+     @note producers never block, a push is a single atomic exchange on the head of the queue
+     @note an item which is being pushed while the consumer pops may only become visible on the next pop
+     */
+    template<typename T>
+    class MpscQueue {
+    public:
+        MpscQueue() : _head(new Node()), _tail(_head.load()) {
+        }
+
+        ~MpscQueue() {
+            T value;
+            while (Pop(&value)) {
+            }
+            delete _tail;
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        /**
+         add an item to the queue, may be called from any thread
+         */
+        void Push(T value) {
+            auto node = new Node(std::move(value));
+            auto previous = _head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        /**
+         take the oldest item from the queue, may only be called from the consumer thread
+         @return false when the queue is empty
+         */
+        bool Pop(T* value) {
+            auto tail = _tail;
+            auto next = tail->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+
+            *value = std::move(next->value);
+            _tail = next;
+            delete tail;
+            return true;
+        }
+
+    private:
+        struct Node {
+            Node() : next(nullptr) {}
+
+            explicit Node(T&& item) : next(nullptr), value(std::move(item)) {}
+
+            std::atomic<Node*> next;
+            T value;
+        };
+
+        std::atomic<Node*> _head;
+        Node* _tail;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_COMMON_UTIL_MPSCQUEUE_H_
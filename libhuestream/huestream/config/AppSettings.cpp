@@ -22,6 +22,7 @@ namespace huestream {
 		PROP_IMPL(AppSettings, int, monitorIntervalConnectionMs, MonitorIntervalConnectionMs);
     PROP_IMPL(AppSettings, std::string, storageEncryptionKey, StorageEncryptionKey);
     PROP_IMPL_BOOL(AppSettings, bool, lightsRetainColor, LightsRetainColor);
+    PROP_IMPL(AppSettings, int, renderThreads, RenderThreads);
 
     AppSettings::AppSettings() {
         SetActivationOverride(ACTIVATION_OVERRIDELEVEL_SAMEGROUP);
@@ -36,6 +37,7 @@ namespace huestream {
         SetMonitorIntervalNotStreamingMs(15000);
 				SetMonitorIntervalConnectionMs(15000);
         SetLightsRetainColor(false);
+        SetRenderThreads(1);
     }
 
     bool AppSettings::UseForcedActivation() {
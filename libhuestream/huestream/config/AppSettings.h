@@ -110,6 +110,13 @@ namespace huestream {
      @note default false, which means the light turns off when all effects are finished
      */
     PROP_DEFINE_BOOL(AppSettings, bool, lightsRetainColor, LightsRetainColor);
+
+    /**
+     set the number of threads used to evaluate effects when rendering
+     @note default 1, which renders all effects on the render thread, with more threads the effects are evaluated in
+     parallel while the mixed result stays identical
+     */
+    PROP_DEFINE(AppSettings, int, renderThreads, RenderThreads);
     };
 
     /**
@@ -23,6 +23,7 @@
 #include <huestream/effect/effects/MultiChannelEffect.h>
 #include <huestream/config/ObjectBuilder.h>
 #include <huestream/effect/lightscript/LightScript.h>
+#include <huestream/effect/RenderProfile.h>
 #include <huestream/effect/effects/base/RadialEffect.h>
 #include <huestream/effect/effects/LightIteratorEffect.h>
 
@@ -59,6 +60,8 @@ std::shared_ptr<Serializable> ObjectBuilder::ConstructInstanceOf(std::string typ
     if (type == Action::type) return std::make_shared<Action>();
     if (type == Scene::type) return std::make_shared<Scene>();
     if (type == Zone::type) return std::make_shared<Zone>();
+    if (type == RenderProfile::type) return std::make_shared<RenderProfile>();
+    if (type == EffectRenderProfile::type) return std::make_shared<EffectRenderProfile>();
 
     return nullptr;
 }
@@ -8,12 +8,16 @@
 
 #include "huestream/common/data/Group.h"
 #include "huestream/effect/effects/base/Effect.h"
+#include "huestream/effect/RenderProfiler.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 
 namespace huestream {
 
+    typedef std::function<void()> MixerCommand;
+
     class IMixer {
     public:
         virtual ~IMixer() = default;
@@ -33,6 +37,18 @@ namespace huestream {
         virtual void Lock() = 0;
 
         virtual void Unlock() = 0;
+
+        /**
+         queue a command which is executed at the start of the next render, on the render thread
+         @note does not block on a render in progress, so can be called without Lock() from any thread
+         @note commands are owned by the mixer, so they should not hold a shared_ptr to the mixer itself
+         */
+        virtual void Enqueue(MixerCommand command) = 0;
+
+        /**
+         get the profiler which measures the render cost of each effect when enabled
+         */
+        virtual RenderProfilerPtr GetProfiler() = 0;
     };
 
     typedef std::shared_ptr<IMixer> MixerPtr;
@@ -4,20 +4,43 @@
  ********************************************************************************/
 
 #include <huestream/effect/Mixer.h>
+#include <huestream/common/time/FrameTime.h>
+#include <huestream/common/time/TimeProviderProvider.h>
+
+#include "support/threading/ThreadPool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <memory>
 #include <iostream>
 #include <string>
+#include <vector>
+
+#if defined(_MSC_VER) || defined(__GNUC__)
+#define HUESTREAM_RESTRICT __restrict
+#else
+#define HUESTREAM_RESTRICT
+#endif
 
 namespace huestream {
 
     Mixer::Mixer() : _effects(std::make_shared<EffectList>()),
-                _group(std::make_shared<Group>()), _retain_color(false) {
+                _group(std::make_shared<Group>()), _retain_color(false), _threadPoolWorkers(0),
+                _effectsChanged(false), _scheduleGeneration(0), _profiler(std::make_shared<RenderProfiler>()),
+                _profiling(false) {
     }
 
     Mixer::Mixer(AppSettingsPtr appSettings) : _effects(std::make_shared<EffectList>()),
-                _group(std::make_shared<Group>()), _retain_color(appSettings->LightsRetainColor()) {
+                _group(std::make_shared<Group>()), _retain_color(appSettings->LightsRetainColor()),
+                _threadPoolWorkers(0), _effectsChanged(false), _scheduleGeneration(0),
+                _profiler(std::make_shared<RenderProfiler>()), _profiling(false) {
+        if (appSettings->GetRenderThreads() > 1) {
+            // the render thread itself also evaluates effects
+            _threadPoolWorkers = static_cast<size_t>(appSettings->GetRenderThreads() - 1);
+            _threadPool = std::make_shared<support::ThreadPool>(_threadPoolWorkers, false, "mixer");
+        }
     }
 
     Mixer::~Mixer() {
@@ -40,6 +63,19 @@ namespace huestream {
         _mtx.unlock();
     }
 
+    void Mixer::Enqueue(MixerCommand command) {
+        _commands.Push(std::move(command));
+    }
+
+    void Mixer::ExecuteCommands() {
+        MixerCommand command;
+        while (_commands.Pop(&command)) {
+            if (command) {
+                command();
+            }
+        }
+    }
+
     EffectPtr Mixer::GetEffectByName(std::string name) {
         for (auto effect : *_effects) {
             if (effect->GetName() == name) {
@@ -51,16 +87,11 @@ namespace huestream {
     }
 
     int Mixer::FindEffectIndex(const EffectPtr &newEffect) const {
-        auto i = 0;
-
-        for (auto effect : *_effects) {
-            if (newEffect->GetLayer() < effect->GetLayer()) {
-                break;
-            }
-            i++;
-        }
-
-        return i;
+        auto it = std::upper_bound(_effects->begin(), _effects->end(), newEffect,
+            [](const EffectPtr &effect, const EffectPtr &other) {
+                return effect->GetLayer() < other->GetLayer();
+            });
+        return static_cast<int>(it - _effects->begin());
     }
 
     void Mixer::AddEffect(EffectPtr newEffect) {
@@ -71,6 +102,7 @@ namespace huestream {
 
         auto i = FindEffectIndex(newEffect);
         _effects->insert(_effects->begin() + i, newEffect);
+        _effectsChanged = true;
     }
 
     void Mixer::AddEffectList(EffectListPtr effects) {
@@ -87,50 +119,191 @@ namespace huestream {
         for (auto effect : *_effects) {
             effect->UpdateGroup(_group);
         }
+        // effect lengths can depend on the lights in the group
+        _effectsChanged = true;
+    }
+
+    void Mixer::UpdateActionSchedules() {
+        // taken before reading the actions, so a change made while scheduling is picked up next frame
+        _scheduleGeneration = Action::GetScheduleGeneration();
+        _actionSchedules.clear();
+        _unscheduledEffects.clear();
+
+        std::vector<ActionList> actions;
+        for (size_t i = 0; i < _effects->size(); ++i) {
+            const auto &effect = (*_effects)[i];
+            auto timeProvider = effect->GetTypeName() == Action::type
+                                ? std::static_pointer_cast<Action>(effect)->GetTimeProvider() : nullptr;
+            if (timeProvider == nullptr) {
+                _unscheduledEffects.push_back(i);
+                continue;
+            }
+
+            auto schedule = std::find_if(_actionSchedules.begin(), _actionSchedules.end(),
+                [&timeProvider](const ActionSchedule &s) {
+                    return s.timeProvider == timeProvider;
+                });
+            if (schedule == _actionSchedules.end()) {
+                _actionSchedules.push_back(ActionSchedule{timeProvider, ActionScheduler(), {}});
+                actions.emplace_back();
+                schedule = _actionSchedules.end() - 1;
+            }
+            schedule->effectIndices.push_back(i);
+            actions[schedule - _actionSchedules.begin()].push_back(std::static_pointer_cast<Action>(effect));
+        }
+
+        for (size_t i = 0; i < _actionSchedules.size(); ++i) {
+            _actionSchedules[i].scheduler.Build(actions[i]);
+        }
+        _effectsChanged = false;
+    }
+
+    void Mixer::UpdateActiveEffects() {
+        if (_effectsChanged || _scheduleGeneration != Action::GetScheduleGeneration()) {
+            UpdateActionSchedules();
+        }
+
+        // only actions which overlap the position of their timeline are considered, other effects always are
+        _activeEffects = _unscheduledEffects;
+        for (auto &schedule : _actionSchedules) {
+            auto first = _activeEffects.size();
+            schedule.scheduler.GetActiveActions(schedule.timeProvider->Now(), &_activeEffects);
+            for (auto i = first; i < _activeEffects.size(); ++i) {
+                _activeEffects[i] = schedule.effectIndices[_activeEffects[i]];
+            }
+        }
+        std::sort(_activeEffects.begin(), _activeEffects.end());
     }
 
     void Mixer::RenderEffects() {
-        for (auto effect : *_effects) {
-            if (effect->IsEnabled()) {
+        for (auto i : _activeEffects) {
+            const auto &effect = (*_effects)[i];
+            if (!effect->IsEnabled()) {
+                continue;
+            }
+
+            if (_profiling) {
+                auto start = RenderProfiler::Now();
+                effect->Render();
+                _profiler->AddRender(effect, RenderProfiler::Now() - start);
+            } else {
                 effect->Render();
             }
         }
     }
 
-    void Mixer::ApplyEffectsOnLight(LightPtr light) const {
-        auto r = 0.0;
-        auto g = 0.0;
-        auto b = 0.0;
-
-        if (_retain_color) {
-            r = light->GetColor().GetR();
-            g = light->GetColor().GetG();
-            b = light->GetColor().GetB();
+    static void Composite(double* HUESTREAM_RESTRICT r, double* HUESTREAM_RESTRICT g, double* HUESTREAM_RESTRICT b,
+                          const double* HUESTREAM_RESTRICT layerR, const double* HUESTREAM_RESTRICT layerG,
+                          const double* HUESTREAM_RESTRICT layerB, const double* HUESTREAM_RESTRICT layerA,
+                          size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            auto alpha = layerA[i];
+            auto prevLayersAlpha = 1.0 - alpha;
+            r[i] = r[i] * prevLayersAlpha + layerR[i] * alpha;
+            g[i] = g[i] * prevLayersAlpha + layerG[i] * alpha;
+            b[i] = b[i] * prevLayersAlpha + layerB[i] * alpha;
         }
+    }
 
-        for (auto effect : *_effects) {
-            if (effect->IsEnabled()) {
-                auto layerColor = effect->GetColor(light);
-                auto alpha = layerColor.GetAlpha();
-                auto prevLayersAlpha = 1.0 - alpha;
+    void Mixer::EvaluateEffects(double* layers, size_t count) {
+        const auto layerSize = 4 * count;
+        std::atomic<size_t> next(0);
+        auto evaluate = [this, &next, layers, layerSize, count]() {
+            for (auto i = next++; i < _enabledEffects.size(); i = next++) {
+                auto layer = layers + i * layerSize;
+                auto start = _profiling ? RenderProfiler::Now() : 0;
+                _enabledEffects[i]->GetColors(_lightBuffer, layer, layer + count, layer + 2 * count, layer + 3 * count);
+                if (_profiling) {
+                    _colorDurations[i] = RenderProfiler::Now() - start;
+                }
+            }
+        };
 
-                r *= prevLayersAlpha;
-                g *= prevLayersAlpha;
-                b *= prevLayersAlpha;
+        std::vector<std::future<void>> workers;
+        if (_threadPool != nullptr) {
+            auto workerCount = std::min(_threadPoolWorkers, _enabledEffects.size() - 1);
+            for (size_t i = 0; i < workerCount; ++i) {
+                workers.push_back(_threadPool->add_task(evaluate));
+            }
+        }
 
-                r += layerColor.GetR() * alpha;
-                g += layerColor.GetG() * alpha;
-                b += layerColor.GetB() * alpha;
+        // the workers use the state of this frame, so they have to finish before any exception is passed on
+        std::exception_ptr error;
+        try {
+            evaluate();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        for (auto& worker : workers) {
+            if (worker.valid()) {
+                worker.wait();
             }
         }
 
-        auto lightColor = Color(r, g, b);
-        light->SetColor(lightColor);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        for (auto& worker : workers) {
+            if (worker.valid()) {
+                worker.get();
+            }
+        }
     }
 
     void Mixer::ApplyEffectsOnLights() {
-        for (auto light : *_group->GetLights()) {
-            ApplyEffectsOnLight(light);
+        const auto& lights = *_group->GetLights();
+        _lightBuffer.Update(_group->GetLights());
+
+        _enabledEffects.clear();
+        for (auto i : _activeEffects) {
+            const auto& effect = (*_effects)[i];
+            if (effect->IsEnabled()) {
+                _enabledEffects.push_back(effect);
+            }
+        }
+
+        const auto count = _lightBuffer.Size();
+        const auto layerSize = 4 * count;
+        _channels.assign(3 * count + layerSize * _enabledEffects.size(), 0.0);
+        auto r = _channels.data();
+        auto g = r + count;
+        auto b = g + count;
+        auto layers = b + count;
+
+        if (_retain_color) {
+            for (size_t i = 0; i < count; ++i) {
+                const auto& color = lights[i]->GetColor();
+                r[i] = color.GetR();
+                g[i] = color.GetG();
+                b[i] = color.GetB();
+            }
+        }
+
+        if (!_enabledEffects.empty()) {
+            if (_profiling) {
+                _colorDurations.assign(_enabledEffects.size(), 0);
+            }
+
+            EvaluateEffects(layers, count);
+
+            if (_profiling) {
+                for (size_t i = 0; i < _enabledEffects.size(); ++i) {
+                    _profiler->AddColors(_enabledEffects[i], _colorDurations[i]);
+                }
+            }
+        }
+
+        // composite in layer order, independent of which thread evaluated an effect
+        for (size_t i = 0; i < _enabledEffects.size(); ++i) {
+            auto layer = layers + i * layerSize;
+            Composite(r, g, b, layer, layer + count, layer + 2 * count, layer + 3 * count, count);
+        }
+        _enabledEffects.clear();
+
+        for (size_t i = 0; i < count; ++i) {
+            lights[i]->SetColor(Color(r[i], g[i], b[i]));
         }
     }
 
@@ -139,6 +312,7 @@ namespace huestream {
         while (i != _effects->end()) {
             if (*i == nullptr || (*i)->IsFinished()) {
                 i = _effects->erase(i);
+                _effectsChanged = true;
             } else {
                 ++i;
             }
@@ -146,13 +320,32 @@ namespace huestream {
     }
 
     void Mixer::Render() {
+        // sample the clock once, so all players of all effects in this frame see the same time
+        FrameTime::Scope frameTime(TimeProviderProvider::get()->Now());
+
+        _profiling = _profiler->IsEnabled();
+        auto start = _profiling ? RenderProfiler::Now() : 0;
+        if (_profiling) {
+            _profiler->BeginFrame();
+        }
+
+        ExecuteCommands();
         RemoveFinishedEffects();
+        UpdateActiveEffects();
         RenderEffects();
         ApplyEffectsOnLights();
+
+        if (_profiling) {
+            _profiler->EndFrame(RenderProfiler::Now() - start);
+        }
     }
 
     GroupPtr Mixer::GetGroup() {
         return _group;
     }
 
+    RenderProfilerPtr Mixer::GetProfiler() {
+        return _profiler;
+    }
+
 }  // namespace huestream
@@ -7,26 +7,64 @@
 #define HUESTREAM_EFFECT_MIXER_H_
 
 #include "huestream/common/data/Group.h"
+#include "huestream/common/data/LightBuffer.h"
+#include "huestream/common/util/MpscQueue.h"
 #include "huestream/effect/IMixer.h"
+#include "huestream/effect/RenderProfiler.h"
+#include "huestream/effect/lightscript/ActionScheduler.h"
 #include "huestream/config/AppSettings.h"
 
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
+
+namespace support {
+    class ThreadPool;
+}  // namespace support
 
 namespace huestream {
 
     class Mixer : public IMixer {
     protected:
+        /**
+         actions which are bound to the same time provider, indexed on the period in which they are active
+         */
+        struct ActionSchedule {
+            TimeProviderPtr timeProvider;
+            ActionScheduler scheduler;
+            std::vector<size_t> effectIndices;
+        };
+
         EffectListPtr _effects;
         GroupPtr _group;
         bool _retain_color;
+        LightBuffer _lightBuffer;
+        std::vector<double> _channels;
+        std::vector<EffectPtr> _enabledEffects;
+        std::shared_ptr<support::ThreadPool> _threadPool;
+        size_t _threadPoolWorkers;
+        MpscQueue<MixerCommand> _commands;
+        std::vector<ActionSchedule> _actionSchedules;
+        std::vector<size_t> _unscheduledEffects;
+        std::vector<size_t> _activeEffects;
+        bool _effectsChanged;
+        uint64_t _scheduleGeneration;
+        RenderProfilerPtr _profiler;
+        bool _profiling;
+        std::vector<int64_t> _colorDurations;
+
+        void ExecuteCommands();
+
+        void UpdateActionSchedules();
+
+        void UpdateActiveEffects();
 
         void RenderEffects();
 
         void ApplyEffectsOnLights();
 
-        void ApplyEffectsOnLight(LightPtr light) const;
+        void EvaluateEffects(double* layers, size_t count);
 
         int FindEffectIndex(const EffectPtr &newEffect) const;
 
@@ -56,6 +94,10 @@ namespace huestream {
         void Lock() override;
 
         void Unlock() override;
+
+        void Enqueue(MixerCommand command) override;
+
+        RenderProfilerPtr GetProfiler() override;
     };
 
 }  // namespace huestream
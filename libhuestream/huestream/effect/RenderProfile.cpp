@@ -0,0 +1,78 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/RenderProfile.h>
+
+#include <memory>
+#include <string>
+
+namespace huestream {
+
+    PROP_IMPL(EffectRenderProfile, std::string, name, Name);
+    PROP_IMPL(EffectRenderProfile, int64_t, layer, Layer);
+    PROP_IMPL(EffectRenderProfile, int64_t, renderCount, RenderCount);
+    PROP_IMPL(EffectRenderProfile, double, renderTime, RenderTime);
+    PROP_IMPL(EffectRenderProfile, int64_t, colorCount, ColorCount);
+    PROP_IMPL(EffectRenderProfile, double, colorTime, ColorTime);
+
+    EffectRenderProfile::EffectRenderProfile() :
+        _layer(0), _renderCount(0), _renderTime(0), _colorCount(0), _colorTime(0) {
+    }
+
+    double EffectRenderProfile::GetTotalTime() const {
+        return _renderTime + _colorTime;
+    }
+
+    std::string EffectRenderProfile::GetTypeName() const {
+        return type;
+    }
+
+    void EffectRenderProfile::Serialize(JSONNode *node) const {
+        Serializable::Serialize(node);
+        SerializeValue(node, AttributeName, _name);
+        SerializeValue(node, AttributeLayer, _layer);
+        SerializeValue(node, AttributeRenderCount, _renderCount);
+        SerializeValue(node, AttributeRenderTime, _renderTime);
+        SerializeValue(node, AttributeColorCount, _colorCount);
+        SerializeValue(node, AttributeColorTime, _colorTime);
+    }
+
+    void EffectRenderProfile::Deserialize(JSONNode *node) {
+        Serializable::Deserialize(node);
+        DeserializeValue(node, AttributeName, &_name, "");
+        DeserializeValue(node, AttributeLayer, &_layer, 0);
+        DeserializeValue(node, AttributeRenderCount, &_renderCount, 0);
+        DeserializeValue(node, AttributeRenderTime, &_renderTime, 0);
+        DeserializeValue(node, AttributeColorCount, &_colorCount, 0);
+        DeserializeValue(node, AttributeColorTime, &_colorTime, 0);
+    }
+
+    PROP_IMPL(RenderProfile, int64_t, frameCount, FrameCount);
+    PROP_IMPL(RenderProfile, double, renderTime, RenderTime);
+    PROP_IMPL(RenderProfile, EffectRenderProfileListPtr, effects, Effects);
+
+    RenderProfile::RenderProfile() :
+        _frameCount(0), _renderTime(0), _effects(std::make_shared<EffectRenderProfileList>()) {
+    }
+
+    std::string RenderProfile::GetTypeName() const {
+        return type;
+    }
+
+    void RenderProfile::Serialize(JSONNode *node) const {
+        Serializable::Serialize(node);
+        SerializeValue(node, AttributeFrameCount, _frameCount);
+        SerializeValue(node, AttributeRenderTime, _renderTime);
+        SerializeList(node, AttributeEffects, _effects);
+    }
+
+    void RenderProfile::Deserialize(JSONNode *node) {
+        Serializable::Deserialize(node);
+        DeserializeValue(node, AttributeFrameCount, &_frameCount, 0);
+        DeserializeValue(node, AttributeRenderTime, &_renderTime, 0);
+        DeserializeList<EffectRenderProfileListPtr, EffectRenderProfile>(node, &_effects, AttributeEffects);
+    }
+
+}  // namespace huestream
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+/** @file */
+
+#ifndef HUESTREAM_EFFECT_RENDERPROFILE_H_
+#define HUESTREAM_EFFECT_RENDERPROFILE_H_
+
+#include "huestream/common/serialize/Serializable.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+namespace huestream {
+
+    /**
+     render cost of all effects with a certain name and layer, summed over the profiled frames
+     */
+    class EffectRenderProfile : public Serializable {
+    public:
+        static constexpr const char* type = "huestream.EffectRenderProfile";
+
+    /**
+     set name of the profiled effects
+     */
+    PROP_DEFINE(EffectRenderProfile, std::string, name, Name);
+
+    /**
+     set layer of the profiled effects
+     */
+    PROP_DEFINE(EffectRenderProfile, int64_t, layer, Layer);
+
+    /**
+     set number of calls to Effect::Render()
+     */
+    PROP_DEFINE(EffectRenderProfile, int64_t, renderCount, RenderCount);
+
+    /**
+     set total time in microseconds spent in Effect::Render()
+     */
+    PROP_DEFINE(EffectRenderProfile, double, renderTime, RenderTime);
+
+    /**
+     set number of calls to Effect::GetColors(), which evaluates the effect for all lights
+     */
+    PROP_DEFINE(EffectRenderProfile, int64_t, colorCount, ColorCount);
+
+    /**
+     set total time in microseconds spent in Effect::GetColors()
+     */
+    PROP_DEFINE(EffectRenderProfile, double, colorTime, ColorTime);
+
+    public:
+        EffectRenderProfile();
+
+        /**
+         get total time in microseconds spent on these effects
+         */
+        double GetTotalTime() const;
+
+        std::string GetTypeName() const override;
+
+        void Serialize(JSONNode *node) const override;
+
+        void Deserialize(JSONNode *node) override;
+    };
+
+    /**
+     shared pointer to a huestream::EffectRenderProfile object
+     */
+    SMART_POINTER_TYPES_FOR(EffectRenderProfile)
+
+    /**
+     render cost of the engine over the last frames, broken down per effect
+     @note use SerializeText() to dump it as JSON
+     @see IHueStream::GetRenderProfile()
+     */
+    class RenderProfile : public Serializable {
+    public:
+        static constexpr const char* type = "huestream.RenderProfile";
+
+    /**
+     set number of profiled frames
+     */
+    PROP_DEFINE(RenderProfile, int64_t, frameCount, FrameCount);
+
+    /**
+     set total time in microseconds spent rendering the profiled frames
+     */
+    PROP_DEFINE(RenderProfile, double, renderTime, RenderTime);
+
+    /**
+     set render cost per effect name and layer, most expensive first
+     */
+    PROP_DEFINE(RenderProfile, EffectRenderProfileListPtr, effects, Effects);
+
+    public:
+        RenderProfile();
+
+        std::string GetTypeName() const override;
+
+        void Serialize(JSONNode *node) const override;
+
+        void Deserialize(JSONNode *node) override;
+    };
+
+    /**
+     shared pointer to a huestream::RenderProfile object
+     */
+    SMART_POINTER_TYPES_FOR(RenderProfile)
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_RENDERPROFILE_H_
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/RenderProfiler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    static const size_t MaxCachedEffects = 4096;
+
+    RenderProfiler::RenderProfiler(size_t frameCapacity) :
+        _enabled(false),
+        _frames(std::max<size_t>(1, frameCapacity)),
+        _nextFrame(0),
+        _frameCount(0) {
+    }
+
+    void RenderProfiler::SetEnabled(bool enabled) {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool RenderProfiler::IsEnabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    RenderProfilePtr RenderProfiler::GetProfile() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        int64_t renderTime = 0;
+        std::vector<Cost> totals(_keys.size(), Cost{0, 0, 0, 0});
+        std::vector<bool> present(_keys.size(), false);
+        for (size_t i = 0; i < _frameCount; ++i) {
+            const auto &frame = _frames[i];
+            renderTime += frame.duration;
+            for (const auto &cost : frame.costs) {
+                auto &total = totals[cost.first];
+                total.renderTime += cost.second.renderTime;
+                total.renderCount += cost.second.renderCount;
+                total.colorTime += cost.second.colorTime;
+                total.colorCount += cost.second.colorCount;
+                present[cost.first] = true;
+            }
+        }
+
+        auto profile = std::make_shared<RenderProfile>();
+        profile->SetFrameCount(static_cast<int64_t>(_frameCount));
+        profile->SetRenderTime(renderTime / 1000.0);
+        for (size_t i = 0; i < _keys.size(); ++i) {
+            if (!present[i]) {
+                continue;
+            }
+            auto effect = std::make_shared<EffectRenderProfile>();
+            effect->SetName(_keys[i].first);
+            effect->SetLayer(_keys[i].second);
+            effect->SetRenderCount(totals[i].renderCount);
+            effect->SetRenderTime(totals[i].renderTime / 1000.0);
+            effect->SetColorCount(totals[i].colorCount);
+            effect->SetColorTime(totals[i].colorTime / 1000.0);
+            profile->GetEffects()->push_back(effect);
+        }
+
+        auto effects = profile->GetEffects();
+        std::stable_sort(effects->begin(), effects->end(),
+            [](const EffectRenderProfilePtr &a, const EffectRenderProfilePtr &b) {
+                return a->GetTotalTime() > b->GetTotalTime();
+            });
+        return profile;
+    }
+
+    void RenderProfiler::Reset() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto &frame : _frames) {
+            frame.costs.clear();
+        }
+        _nextFrame = 0;
+        _frameCount = 0;
+    }
+
+    void RenderProfiler::BeginFrame() {
+        for (auto key : _currentKeys) {
+            _currentCosts[key] = Cost{0, 0, 0, 0};
+        }
+        _currentKeys.clear();
+
+        // effects are cached by address, which may be reused after an effect has been destroyed
+        if (_effectKeys.size() > MaxCachedEffects) {
+            _effectKeys.clear();
+        }
+    }
+
+    void RenderProfiler::AddRender(const EffectPtr &effect, int64_t duration) {
+        auto &cost = GetCurrentCost(effect);
+        cost.renderTime += duration;
+        cost.renderCount++;
+    }
+
+    void RenderProfiler::AddColors(const EffectPtr &effect, int64_t duration) {
+        auto &cost = GetCurrentCost(effect);
+        cost.colorTime += duration;
+        cost.colorCount++;
+    }
+
+    void RenderProfiler::EndFrame(int64_t duration) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto &frame = _frames[_nextFrame];
+        frame.duration = duration;
+        frame.costs.clear();
+        for (auto key : _currentKeys) {
+            frame.costs.emplace_back(key, _currentCosts[key]);
+            _currentCosts[key] = Cost{0, 0, 0, 0};
+        }
+        _currentKeys.clear();
+
+        _nextFrame = (_nextFrame + 1) % _frames.size();
+        _frameCount = std::min(_frameCount + 1, _frames.size());
+    }
+
+    int64_t RenderProfiler::Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    RenderProfiler::Cost &RenderProfiler::GetCurrentCost(const EffectPtr &effect) {
+        auto key = GetKeyIndex(effect);
+        if (key >= _currentCosts.size()) {
+            _currentCosts.resize(key + 1, Cost{0, 0, 0, 0});
+        }
+
+        auto &cost = _currentCosts[key];
+        if (cost.renderCount == 0 && cost.colorCount == 0) {
+            _currentKeys.push_back(key);
+        }
+        return cost;
+    }
+
+    size_t RenderProfiler::GetKeyIndex(const EffectPtr &effect) {
+        auto cached = _effectKeys.find(effect.get());
+        if (cached != _effectKeys.end()) {
+            const auto &key = _keys[cached->second];
+            if (key.second == effect->GetLayer() && key.first == effect->GetName()) {
+                return cached->second;
+            }
+        }
+
+        Key key(effect->GetName(), effect->GetLayer());
+        auto it = _keyIndices.find(key);
+        size_t index;
+        if (it != _keyIndices.end()) {
+            index = it->second;
+        } else {
+            std::lock_guard<std::mutex> lock(_mutex);
+            index = _keys.size();
+            _keys.push_back(key);
+            _keyIndices[key] = index;
+        }
+
+        _effectKeys[effect.get()] = index;
+        return index;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+/** @file */
+
+#ifndef HUESTREAM_EFFECT_RENDERPROFILER_H_
+#define HUESTREAM_EFFECT_RENDERPROFILER_H_
+
+#include "huestream/effect/RenderProfile.h"
+#include "huestream/effect/effects/base/Effect.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     measures the time the mixer spends on each effect and keeps the measurements of the last frames in a ring buffer
+     @note disabled by default, the mixer then only checks IsEnabled() once per frame
+     @note the Add and Frame methods are called by the render thread, the other methods can be called from any thread
+     */
+    class RenderProfiler {
+    public:
+        /**
+         constructor
+         @param frameCapacity Number of frames kept in the ring buffer
+         */
+        explicit RenderProfiler(size_t frameCapacity = 250);
+
+        void SetEnabled(bool enabled);
+
+        bool IsEnabled() const;
+
+        /**
+         get render cost over the frames in the ring buffer
+         */
+        RenderProfilePtr GetProfile() const;
+
+        /**
+         clear the ring buffer
+         */
+        void Reset();
+
+        void BeginFrame();
+
+        /**
+         add time spent in Effect::Render() in the current frame
+         @param duration Duration in nanoseconds
+         */
+        void AddRender(const EffectPtr &effect, int64_t duration);
+
+        /**
+         add time spent in Effect::GetColors() in the current frame
+         @param duration Duration in nanoseconds
+         */
+        void AddColors(const EffectPtr &effect, int64_t duration);
+
+        /**
+         store the current frame in the ring buffer
+         @param duration Duration of the whole frame in nanoseconds
+         */
+        void EndFrame(int64_t duration);
+
+        /**
+         get monotonic time in nanoseconds to measure durations with
+         */
+        static int64_t Now();
+
+    private:
+        struct Cost {
+            int64_t renderTime;
+            int64_t renderCount;
+            int64_t colorTime;
+            int64_t colorCount;
+        };
+
+        struct Frame {
+            int64_t duration;
+            std::vector<std::pair<size_t, Cost>> costs;
+        };
+
+        typedef std::pair<std::string, unsigned int> Key;
+
+        Cost &GetCurrentCost(const EffectPtr &effect);
+
+        size_t GetKeyIndex(const EffectPtr &effect);
+
+        std::atomic<bool> _enabled;
+        mutable std::mutex _mutex;
+        std::vector<Key> _keys;
+        std::map<Key, size_t> _keyIndices;
+        std::unordered_map<const Effect *, size_t> _effectKeys;
+        std::vector<Cost> _currentCosts;
+        std::vector<size_t> _currentKeys;
+        std::vector<Frame> _frames;
+        size_t _nextFrame;
+        size_t _frameCount;
+    };
+
+    /**
+     shared pointer to a huestream::RenderProfiler object
+     */
+    typedef std::shared_ptr<RenderProfiler> RenderProfilerPtr;
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_RENDERPROFILER_H_
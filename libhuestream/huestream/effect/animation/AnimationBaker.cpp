@@ -0,0 +1,104 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/animation/AnimationBaker.h>
+#include <huestream/effect/animation/animations/ConstantAnimation.h>
+#include <huestream/effect/animation/animations/CurveAnimation.h>
+#include <huestream/effect/animation/animations/FramesAnimation.h>
+#include <huestream/effect/animation/animations/SequenceAnimation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    static bool IsRepeatable(const AnimationPtr &animation) {
+        auto typeName = animation->GetTypeName();
+        return typeName == CurveAnimation::type || typeName == SequenceAnimation::type;
+    }
+
+    AnimationBaker::AnimationBaker(double fps, double tolerance) : _fps(fps), _tolerance(tolerance) {
+    }
+
+    AnimationPtr AnimationBaker::Bake(const AnimationPtr &animation) const {
+        if (!CanBake(animation)) {
+            return animation;
+        }
+
+        auto length = animation->GetLengthMs();
+        auto frameCount = std::max<size_t>(2, static_cast<size_t>(std::ceil(length * _fps / 1000.0)));
+        auto frameLength = length / frameCount;
+
+        auto live = animation->Clone();
+        if (IsRepeatable(live)) {
+            std::static_pointer_cast<RepeatableAnimation>(live)->SetRepeatTimes(0);
+        }
+        live->Rewind();
+
+        // sample every frame and halfway between frames, the last frame lies exactly at the end
+        auto sampleCount = 2 * frameCount + 1;
+        std::vector<double> positions(sampleCount);
+        std::vector<double> values(sampleCount);
+        for (size_t i = 0; i < sampleCount; ++i) {
+            positions[i] = i + 1 < sampleCount ? i * frameLength / 2 : length;
+            live->SetMarker(positions[i]);
+            values[i] = live->GetValue();
+            if (!(values[i] >= 0 && values[i] <= 1)) {
+                return animation;
+            }
+        }
+
+        auto baked = std::make_shared<FramesAnimation>(1000.0 / frameLength, static_cast<unsigned int>(frameCount + 1));
+        baked->SetLastFrameAtEnd(true);
+        for (size_t i = 0; i < sampleCount; i += 2) {
+            baked->Append(values[i]);
+        }
+
+        for (size_t i = 0; i < sampleCount; ++i) {
+            double value = 0;
+            baked->UpdateValue(&value, positions[i]);
+            if (std::abs(value - values[i]) > _tolerance) {
+                return animation;
+            }
+        }
+
+        if (IsRepeatable(animation)) {
+            baked->SetRepeatTimes(std::static_pointer_cast<RepeatableAnimation>(animation)->GetRepeatTimes());
+        }
+        baked->Rewind();
+        return baked;
+    }
+
+    double AnimationBaker::GetFps() const {
+        return _fps;
+    }
+
+    double AnimationBaker::GetTolerance() const {
+        return _tolerance;
+    }
+
+    bool AnimationBaker::CanBake(const AnimationPtr &animation) const {
+        if (animation == nullptr || !animation->IsStateless()) {
+            return false;
+        }
+
+        auto typeName = animation->GetTypeName();
+        if (typeName == FramesAnimation::type || typeName == ConstantAnimation::type) {
+            return false;
+        }
+
+        if (typeName == SequenceAnimation::type &&
+            std::static_pointer_cast<SequenceAnimation>(animation)->get_num_triggers() > 0) {
+            return false;
+        }
+
+        auto length = animation->GetLengthMs();
+        return length > 0 && length != INF;
+    }
+
+}  // namespace huestream
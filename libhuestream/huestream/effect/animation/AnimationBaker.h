@@ -0,0 +1,53 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_EFFECT_ANIMATION_ANIMATIONBAKER_H_
+#define HUESTREAM_EFFECT_ANIMATION_ANIMATIONBAKER_H_
+
+#include "huestream/effect/animation/animations/base/Animation.h"
+
+namespace huestream {
+
+    /**
+     compiles an animation graph into a huestream::FramesAnimation with equally spaced frames, such that evaluating it costs a table lookup
+     @note only finite stateless animations with values between 0 and 1 can be baked, all other animations are kept as they are
+     @note the baked animation is checked against live evaluation halfway between frames and rejected if it deviates more than the tolerance
+     */
+    class AnimationBaker {
+    public:
+        /**
+         constructor
+         @param fps Frames per second at which animations are sampled
+         @param tolerance Maximum allowed deviation between baked and live value
+         */
+        explicit AnimationBaker(double fps = 50, double tolerance = 0.005);
+
+        /**
+         bake an animation
+         @param animation Animation to bake, is not modified
+         @return baked animation, or the given animation itself if it can not be baked within tolerance
+         */
+        AnimationPtr Bake(const AnimationPtr &animation) const;
+
+        /**
+         get frames per second at which animations are sampled
+         */
+        double GetFps() const;
+
+        /**
+         get maximum allowed deviation between baked and live value
+         */
+        double GetTolerance() const;
+
+    private:
+        bool CanBake(const AnimationPtr &animation) const;
+
+        double _fps;
+        double _tolerance;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_ANIMATION_ANIMATIONBAKER_H_
@@ -5,8 +5,7 @@
 
 #include <huestream/config/Config.h>
 #include <huestream/effect/animation/animations/base/Animation.h>
-#include <huestream/common/time/TimeManager.h>
-#include <huestream/common/time/TimeProviderProvider.h>
+#include <huestream/common/time/FrameTime.h>
 #include <huestream/effect/animation/Player.h>
 
 #include <math.h>
@@ -59,10 +58,7 @@ namespace huestream {
     }
 
     void Player::Start() {
-        auto timeProvider = TimeProviderProvider::get();
-        auto diffTs = timeProvider->Now() - _oldTs;
-        _timeStampWithSpeedCorrection += llround(diffTs * _speed);
-        _oldTs = timeProvider->Now();
+        AdvanceTime();
 
         _startPosition = _timeStampWithSpeedCorrection;
         for (auto &animation : *_animations) {
@@ -82,10 +78,7 @@ namespace huestream {
     }
 
     void Player::UpdateMarkers() {
-        auto timeProvider = TimeProviderProvider::get();
-        auto diffTs = timeProvider->Now() - _oldTs;
-        _timeStampWithSpeedCorrection += llround(diffTs * _speed);
-        _oldTs = timeProvider->Now();
+        AdvanceTime();
 
         auto allEndingAnimationsAreStopped = true;
         auto endingAnimationPresent = false;
@@ -115,6 +108,12 @@ namespace huestream {
         }
     }
 
+    void Player::AdvanceTime() {
+        auto now = FrameTime::Now();
+        _timeStampWithSpeedCorrection += llround((now - _oldTs) * _speed);
+        _oldTs = now;
+    }
+
     double Player::getNowFromStartPosition() const {
         return static_cast<double>(_timeStampWithSpeedCorrection - _startPosition);
     }
@@ -46,6 +46,7 @@ namespace huestream {
         } _state;
 
         void RewindNewAnimations(AnimationListPtr animations) const;
+        void AdvanceTime();
         double getNowFromStartPosition() const;
         bool AnimationIsBound(AnimationPtr animation) const;
     };
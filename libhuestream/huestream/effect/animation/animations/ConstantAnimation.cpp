@@ -22,6 +22,10 @@ namespace huestream {
 
     double ConstantAnimation::GetLengthMs() const { return _length; }
 
+    bool ConstantAnimation::IsStateless() const {
+        return true;
+    }
+
     AnimationPtr ConstantAnimation::Clone() {
         return std::make_shared<ConstantAnimation>(*this);
     }
@@ -38,6 +38,8 @@ class ConstantAnimation : public Animation {
 
     void UpdateValue(double *value, double positionMs) override;
 
+    bool IsStateless() const override;
+
     ConstantAnimation(double value, double length);
 
     /**
@@ -28,7 +28,7 @@ namespace huestream {
     void CurveAnimation::Deserialize(JSONNode *node) {
         RepeatableAnimation::Deserialize(node);
         if (SerializerHelper::IsAttributeSet(node, AttributeCurveData)) {
-            JSONNode v = (*node)[AttributeCurveData];
+            JSONNode &v = (*node)[AttributeCurveData];
             _curveData.Deserialize(&v);
         }
     }
@@ -45,6 +45,19 @@ namespace huestream {
         return _curveData.GetLength();
     }
 
+    bool CurveAnimation::IsStateless() const {
+        return true;
+    }
+
+    double CurveAnimation::GetPositionFromValue(double value) {
+        auto position = 0.0;
+        if (_curveData.GetPositionFromValue(value, &position)) {
+            return position;
+        }
+
+        return Animation::GetPositionFromValue(value);
+    }
+
     CurveAnimation::CurveAnimation(PointListPtr points, Nullable<CurveOptions> options)
             : RepeatableAnimation(0), _curveData(points, options) {}
 
@@ -56,6 +56,10 @@ namespace huestream {
 
         double GetLengthMs() const override;
 
+        double GetPositionFromValue(double value) override;
+
+        bool IsStateless() const override;
+
         /**
          append another curve to this curve
          */
@@ -74,6 +78,10 @@ namespace huestream {
          */
         void AppendPointLinearized(const PointPtr point, double delta = 0.000015);
 
+        /**
+         get the points of the curve
+         @see CurveData::GetPoints()
+         */
         const PointListPtr &GetPoints() const;
     };
 }  // namespace huestream
@@ -19,11 +19,13 @@ namespace huestream {
 
     PROP_IMPL(FramesAnimation, std::shared_ptr<std::vector<uint16_t>>, frames, Frames);
     PROP_IMPL(FramesAnimation, bool, compressionEnabled, CompressionEnabled);
+    PROP_IMPL(FramesAnimation, bool, lastFrameAtEnd, LastFrameAtEnd);
 
     FramesAnimation::FramesAnimation() : FramesAnimation(24) {}
 
     FramesAnimation::FramesAnimation(double fps)
-            : RepeatableAnimation(0), _frames(std::make_shared<std::vector<uint16_t>>()), _compressionEnabled(true) {
+            : RepeatableAnimation(0), _frames(std::make_shared<std::vector<uint16_t>>()), _compressionEnabled(true),
+              _lastFrameAtEnd(false) {
         SetFps(fps);
     }
 
@@ -54,9 +56,16 @@ namespace huestream {
     }
 
     double FramesAnimation::GetLengthMs() const {
+        if (_lastFrameAtEnd && _frames->size() > 0) {
+            return (_frames->size() - 1) * _frameLength;
+        }
         return _frames->size() * _frameLength;
     }
 
+    bool FramesAnimation::IsStateless() const {
+        return true;
+    }
+
     void FramesAnimation::Append(const double frame) {
         _frames->push_back(static_cast<uint16_t>(frame * UINT16_MAX));
     }
@@ -65,6 +74,8 @@ namespace huestream {
         RepeatableAnimation::Serialize(node);
 
         SerializeValue(node, AttributeFps, _fpms * 1000.0);
+        if (_lastFrameAtEnd)
+            SerializeValue(node, AttributeLastFrameAtEnd, _lastFrameAtEnd);
 
         if (_compressionEnabled) {
             SerializeFramesCompressed(node);
@@ -77,12 +88,14 @@ namespace huestream {
         RepeatableAnimation::Deserialize(node);
 
         if (SerializerHelper::IsAttributeSet(node, AttributeFps)) {
-            auto jsonFps = (*node)[AttributeFps];
+            auto &jsonFps = (*node)[AttributeFps];
             SetFps(jsonFps.as_float());
         }
 
+        DeserializeValue(node, AttributeLastFrameAtEnd, &_lastFrameAtEnd, false);
+
         if (SerializerHelper::IsAttributeSet(node, AttributeFrames)) {
-            auto jsonFrames = (*node)[AttributeFrames];
+            auto &jsonFrames = (*node)[AttributeFrames];
 
             _frames->clear();
             if (jsonFrames.type() == JSON_ARRAY) {
@@ -27,6 +27,12 @@ namespace huestream {
         PROP_DEFINE(FramesAnimation, std::shared_ptr<std::vector<uint16_t>>, frames, Frames);
         PROP_DEFINE(FramesAnimation, bool, compressionEnabled, CompressionEnabled);
 
+        /**
+         whether the last frame is positioned at the end of the animation instead of lasting one frame
+         @note when enabled the length is one frame shorter and the final interval is interpolated towards the last frame
+         */
+        PROP_DEFINE(FramesAnimation, bool, lastFrameAtEnd, LastFrameAtEnd);
+
     public:
         FramesAnimation();
 
@@ -51,6 +57,8 @@ namespace huestream {
 
         double GetLengthMs() const override;
 
+        bool IsStateless() const override;
+
         /**
          append frame
          */
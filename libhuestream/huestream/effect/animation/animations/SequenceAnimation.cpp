@@ -67,6 +67,15 @@ namespace huestream {
         return length;
     }
 
+    bool SequenceAnimation::IsStateless() const {
+        for (const auto& animation : *_sequences) {
+            if (!animation->IsStateless()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     int SequenceAnimation::Append(AnimationPtr animation, std::string bookmark) {
         _sequences->push_back(animation);
         auto index = static_cast<int>(_sequences->size()) - 1;
@@ -170,9 +179,9 @@ namespace huestream {
 
         _sequences->clear();
         if (SerializerHelper::IsAttributeSet(node, AttributeSequences)) {
-            auto listNode = (*node)[AttributeSequences];
+            auto &listNode = (*node)[AttributeSequences];
             for (auto it = listNode.begin(); it != listNode.end(); ++it) {
-                JSONNode itemNode = *it;
+                JSONNode &itemNode = *it;
                 auto animation = std::static_pointer_cast<Animation>(Serializable::DeserializeFromJson(&itemNode));
                 _sequences->push_back(animation);
             }
@@ -180,7 +189,7 @@ namespace huestream {
 
         bookmarks_.clear();
         if (SerializerHelper::IsAttributeSet(node, AttributeBookmarks)) {
-            auto listNode = (*node)[AttributeBookmarks];
+            auto &listNode = (*node)[AttributeBookmarks];
             for (auto it = listNode.begin(); it != listNode.end(); ++it) {
                 bookmarks_[it->name()] = static_cast<int>(it->as_int());
             }
@@ -56,6 +56,8 @@ namespace huestream {
 
         double GetLengthMs() const override;
 
+        bool IsStateless() const override;
+
         std::string GetTypeName() const override;
 
         void Serialize(JSONNode *node) const override;
@@ -3,7 +3,6 @@
  All Rights Reserved.
  ********************************************************************************/
 
-#include <huestream/common/util/HueMath.h>
 #include <huestream/effect/animation/animations/TweenAnimation.h>
 
 #include <memory>
@@ -18,20 +17,20 @@ namespace huestream {
     static const int default_time = 1000;
     static const TweenType default_tween_type = TweenType::Linear;
 
-    PROP_IMPL(TweenAnimation, double, begin, Begin);
-    PROP_IMPL(TweenAnimation, double, end, End);
-    PROP_IMPL(TweenAnimation, double, time, Time);
+    PROP_IMPL_ON_UPDATE_CALL(TweenAnimation, double, begin, Begin, Compile);
+    PROP_IMPL_ON_UPDATE_CALL(TweenAnimation, double, end, End, Compile);
+    PROP_IMPL_ON_UPDATE_CALL(TweenAnimation, double, time, Time, Compile);
     PROP_IMPL_BOOL(TweenAnimation, bool, beginValuePresent, BeginValuePresent);
-    PROP_IMPL(TweenAnimation, TweenType, tweenType, TweenType);
+    PROP_IMPL_ON_UPDATE_CALL(TweenAnimation, TweenType, tweenType, TweenType, Compile);
 
 
     TweenAnimation::TweenAnimation(double valueBegin, double valueEnd, double timeMs, TweenType tweenType)
             : _begin(valueBegin), _end(valueEnd), _time(timeMs), _beginValuePresent(default_at_beginning),
-              _tweenType(tweenType), at_beginning_(true) {}
+              _tweenType(tweenType), at_beginning_(true), _kernel(tweenType, valueBegin, valueEnd, timeMs) {}
 
     TweenAnimation::TweenAnimation(double valueEnd, double timeMs, TweenType tweenType)
             : _begin(default_begin), _end(valueEnd), _time(timeMs), _beginValuePresent(false),
-              _tweenType(tweenType), at_beginning_(true) {}
+              _tweenType(tweenType), at_beginning_(true), _kernel(tweenType, default_begin, valueEnd, timeMs) {}
 
     TweenAnimation::TweenAnimation() {
         InitializeDefault();
@@ -44,22 +43,10 @@ namespace huestream {
     void TweenAnimation::UpdateValue(double *value, double positionMs) {
         if (!_beginValuePresent && at_beginning_) {
             _begin = *value;
+            Compile();
         }
 
-        switch (_tweenType) {
-            case TweenType::Linear: {
-                *value = HueMath::linearTween(positionMs, _begin, _end, _time);
-                break;
-            }
-            case TweenType::EaseInOutQuad: {
-                *value = HueMath::easeInOutQuad(positionMs, _begin, _end, _time);
-                break;
-            }
-            case TweenType::EaseInOutSine: {
-                *value = HueMath::easeInOutSine(positionMs, _begin, _end, _time);
-                break;
-            }
-        }
+        *value = _kernel.Evaluate(positionMs);
 
         if (*value == 0) {
             *value = 0;
@@ -69,34 +56,10 @@ namespace huestream {
     }
 
     double TweenAnimation::GetPositionFromValue(double value) {
-        double pos = 0;
-        int value_rounded = static_cast<int>(value * 1000);
-        do {
-            switch (_tweenType) {
-                case TweenType::Linear: {
-                    int result_rounded = static_cast<int>(HueMath::linearTween(pos, _begin, _end, _time) * 1000);
-                    if (result_rounded == value_rounded) {
-                        return pos;
-                    }
-                    break;
-                }
-                case TweenType::EaseInOutQuad: {
-                    int result_rounded = static_cast<int>(HueMath::easeInOutQuad(pos, _begin, _end, _time) * 1000);
-                    if (result_rounded == value_rounded) {
-                        return pos;
-                    }
-                    break;
-                }
-                case TweenType::EaseInOutSine: {
-                    int result_rounded = static_cast<int>(HueMath::easeInOutSine(pos, _begin, _end, _time) * 1000);
-                    if (result_rounded == value_rounded) {
-                        return pos;
-                    }
-                    break;
-                }
-            }
-            pos++;
-        } while (pos <= _time);
+        auto position = 0.0;
+        if (_kernel.Invert(value, &position)) {
+            return position;
+        }
 
         return Animation::GetPositionFromValue(value);
     }
@@ -105,6 +68,11 @@ namespace huestream {
         return _time;
     }
 
+    bool TweenAnimation::IsStateless() const {
+        // without begin value the tween starts from the value it had when it was rewound
+        return _beginValuePresent;
+    }
+
     void TweenAnimation::Rewind() {
         Animation::Rewind();
         at_beginning_ = true;
@@ -141,6 +109,7 @@ namespace huestream {
         DeserializeValue(node, AttributeBegin, &_begin, default_begin);
         DeserializeValue(node, AttributeEnd, &_end, default_end);
         DeserializeValue(node, AttributeTime, &_time, default_time);
+        Compile();
     }
 
     void TweenAnimation::InitializeDefault() {
@@ -150,6 +119,15 @@ namespace huestream {
         _end = default_end;
         _time = default_time;
         _tweenType = default_tween_type;
+        Compile();
+    }
+
+    const TweenKernel &TweenAnimation::GetKernel() const {
+        return _kernel;
+    }
+
+    void TweenAnimation::Compile() {
+        _kernel = TweenKernel(_tweenType, _begin, _end, _time);
     }
 
 }  // namespace huestream
@@ -8,6 +8,7 @@
 
 #include "huestream/effect/animation/animations/base/Animation.h"
 #include "huestream/common/serialize/Serializable.h"
+#include "huestream/effect/animation/data/TweenKernel.h"
 #include "huestream/effect/animation/data/TweenType.h"
 
 #include <string>
@@ -53,6 +54,9 @@ namespace huestream {
 
     private:
         bool at_beginning_;
+        TweenKernel _kernel;
+
+        void Compile();
 
     public:
         /**
@@ -77,11 +81,19 @@ namespace huestream {
 
         double GetPositionFromValue(double value) override;
 
+        bool IsStateless() const override;
+
         double GetLengthMs() const override;
 
         void Rewind() override;
 
         void InitializeDefault();
+
+        /**
+         get the trajectory of this animation compiled for its current begin value, end value, duration and type
+         @note can be used to evaluate many positions at once
+         */
+        const TweenKernel &GetKernel() const;
     };
 
 }  // namespace huestream
@@ -51,6 +51,10 @@ namespace huestream {
         return 0;
     }
 
+    bool Animation::IsStateless() const {
+        return false;
+    }
+
     void Animation::SetTweenTypeIfAttributeExists(const JSONNode *node, const std::string &attributeName, TweenType *value,
                                                   TweenType default_value) {
         std::string tweenType;
@@ -98,6 +98,11 @@ namespace huestream {
          */
         virtual double GetPositionFromValue(double value);
 
+        /**
+         check if the value only depends on the marker, so one instance can be evaluated at different positions by multiple users instead of cloning it
+         */
+        virtual bool IsStateless() const;
+
      protected:
         static void AddTweenType(JSONNode *node, const std::string &attribute_name, const TweenType &value);
 
@@ -16,25 +16,83 @@
 namespace huestream {
 
 PROP_IMPL(CurveData, Nullable<CurveOptions>, options, Options);
-PROP_IMPL(CurveData, PointListPtr, points, Points);
+std::string CurveData::AttributePoints = "Points";
 
 CurveData::CurveData() :
     _options(Nullable<CurveOptions>()),
-    _points(NEW_LIST_PTR(Point)),
+    _points(std::make_shared<PointArrays>()),
+    _rangeMin(),
+    _rangeMax(),
     _lastIndex(0) {
 }
 
 CurveData::CurveData(PointListPtr points, Nullable<CurveOptions> options) :
     _options(options),
-    _points(NEW_LIST_PTR(Point)),
+    _points(std::make_shared<PointArrays>()),
+    _rangeMin(),
+    _rangeMax(),
     _lastIndex(0) {
+    SetPoints(points);
+}
+
+CurveData::PointArrays::PointArrays() : x(), y(), pointListLock(), pointList() {
+}
+
+CurveData::PointArrays::PointArrays(const PointArrays &other) : x(other.x), y(other.y), pointListLock(), pointList() {
+}
+
+const PointListPtr &CurveData::GetPoints() const {
+    // the storage and so the list can be shared with copies on other threads
+    std::lock_guard<std::mutex> lock(_points->pointListLock);
+    if (_points->pointList == nullptr) {
+        auto points = NEW_LIST_PTR(Point);
+        points->reserve(_points->x.size());
+        for (size_t i = 0; i < _points->x.size(); ++i) {
+            points->push_back(NEW_PTR(Point, _points->x[i], _points->y[i]));
+        }
+        _points->pointList = points;
+    }
+    return _points->pointList;
+}
+
+void CurveData::SetPoints(const PointListPtr &points) {
+    auto& arrays = GetMutablePoints();
+    arrays.x.clear();
+    arrays.y.clear();
     if (points != nullptr) {
-        for (auto point : *points) {
-            _points->push_back(point);
+        arrays.x.reserve(points->size());
+        arrays.y.reserve(points->size());
+        for (const auto& point : *points) {
+            arrays.x.push_back(point->GetX());
+            arrays.y.push_back(point->GetY());
         }
     }
 }
 
+size_t CurveData::GetPointCount() const {
+    return _points->x.size();
+}
+
+const double* CurveData::GetX() const {
+    return _points->x.data();
+}
+
+const double* CurveData::GetY() const {
+    return _points->y.data();
+}
+
+CurveData::PointArrays& CurveData::GetMutablePoints() {
+    if (_points.use_count() > 1) {
+        _points = std::make_shared<PointArrays>(*_points);
+    } else {
+        std::lock_guard<std::mutex> lock(_points->pointListLock);
+        _points->pointList.reset();
+    }
+    _rangeMin.clear();
+    _rangeMax.clear();
+    return *_points;
+}
+
 double CurveData::CorrectValue(double v) const {
     if (!_options.has_value()) {
         return v;
@@ -67,131 +125,190 @@ double CurveData::GetLength() const {
 
 double CurveData::GetBegin() const {
     if (!HasPoints()) return 0;
-    return _points->front()->GetX();
+    return _points->x.front();
 }
 
 double CurveData::GetEnd() const {
     if (!HasPoints()) return 0;
-    return _points->back()->GetX();
+    return _points->x.back();
 }
 
 bool CurveData::HasPoints() const {
-    return _points->size() > 0;
+    return !_points->x.empty();
 }
 
-bool CurveData::IsClosestLower(PointList::iterator it, double x) {
-    auto isValidAndLower = (it != _points->end()) && ((*it)->GetX() <= x);
-    auto isLastOrNextIsHigher = ((it + 1) == _points->end()) || ((*(it + 1))->GetX() > x);
+bool CurveData::IsClosestLower(size_t index, double x) const {
+    const auto& xs = _points->x;
+    auto isValidAndLower = (index < xs.size()) && (xs[index] <= x);
+    auto isLastOrNextIsHigher = (index + 1 >= xs.size()) || (xs[index + 1] > x);
     return isValidAndLower && isLastOrNextIsHigher;
 }
 
-PointList::iterator CurveData::GetStartPoint(double x) {
-    if (_lastIndex >= _points->size())
+size_t CurveData::GetStartIndex(double x) {
+    const auto& xs = _points->x;
+    if (_lastIndex >= xs.size())
         _lastIndex = 0;
 
     //shortcut last or next point, as it applies in most cases
-    auto lastIter = _points->begin() + _lastIndex;
-    for (auto it = lastIter; it < lastIter + 2; ++it) {
-        if (IsClosestLower(it, x)) {
-            _lastIndex = it - _points->begin();
-            return it;
+    for (auto index = _lastIndex; index < _lastIndex + 2; ++index) {
+        if (IsClosestLower(index, x)) {
+            _lastIndex = index;
+            return index;
         }
     }
 
     //else perform binary search
-    auto result = std::upper_bound(_points->begin(), _points->end(), x,
-        [](const double x, const PointPtr &p) { return x < p->GetX(); });
+    auto result = std::upper_bound(xs.begin(), xs.end(), x);
 
-    if (result == _points->begin()) {
-        result = _points->end();
-    } else {
-        result--;
-        _lastIndex = result - _points->begin();
+    if (result == xs.begin()) {
+        return xs.size();
     }
 
-    return result;
-}
-
-bool CurveData::GetStartAndEndPoint(double x, PointPtr *start, PointPtr *end) {
-    auto iter = GetStartPoint(x);
-    
-    if (iter == _points->end() || (iter + 1) == _points->end())
-        return false;
-    
-    *start = *iter;
-    *end = *(iter + 1);
-    return true;
+    _lastIndex = (result - xs.begin()) - 1;
+    return _lastIndex;
 }
 
-double CurveData::Interpolate(PointPtr start, PointPtr end, double x) {
-    auto time = end->GetX() - start->GetX();
-    auto absX = x - start->GetX();
-    auto beginValue = start->GetY();
-    auto endValue = end->GetY();
-    return HueMath::linearTween(absX, beginValue, endValue, time);
+double CurveData::Interpolate(double startX, double startY, double endX, double endY, double x) {
+    auto time = endX - startX;
+    auto absX = x - startX;
+    return HueMath::linearTween(absX, startY, endY, time);
 }
 
 double CurveData::GetInterpolatedValue(double x) {
-    if (_points->size() < 2) return _points->front()->GetY();
-    if (x <= GetBegin()) return _points->front()->GetY();
-    if (x >= GetEnd()) return _points->back()->GetY();
-
-    PointPtr start;
-    PointPtr end;
-    GetStartAndEndPoint(x, &start, &end);
+    const auto& xs = _points->x;
+    const auto& ys = _points->y;
+    if (xs.size() < 2) return ys.front();
+    if (x <= GetBegin()) return ys.front();
+    if (x >= GetEnd()) return ys.back();
 
-    auto interpolatedValue = Interpolate(start, end, x);
+    auto start = GetStartIndex(x);
+    auto interpolatedValue = Interpolate(xs[start], ys[start], xs[start + 1], ys[start + 1], x);
 
     auto corrected = CorrectValue(interpolatedValue);
 
     return corrected;
 }
 
+bool CurveData::GetPositionFromValue(double value, double *position) {
+    const auto& xs = _points->x;
+    const auto& ys = _points->y;
+    if (xs.empty()) {
+        return false;
+    }
+
+    if (_options.has_value() && _options.get_value().GetMultiplyFactor() != 0) {
+        value /= _options.get_value().GetMultiplyFactor();
+    }
+
+    if (xs.size() == 1) {
+        *position = xs.front();
+        return ys.front() == value;
+    }
+
+    const auto segments = xs.size() - 1;
+    if (_rangeMin.empty()) {
+        _rangeMin.resize(4 * segments);
+        _rangeMax.resize(4 * segments);
+        BuildRangeTree(1, 0, segments - 1);
+    }
+
+    size_t segment = 0;
+    if (!FindFirstSegment(1, 0, segments - 1, value, &segment)) {
+        return false;
+    }
+
+    auto startY = ys[segment];
+    auto endY = ys[segment + 1];
+    auto fraction = (startY == endY) ? 0 : (value - startY) / (endY - startY);
+    *position = xs[segment] + fraction * (xs[segment + 1] - xs[segment]);
+    return true;
+}
+
+void CurveData::BuildRangeTree(size_t node, size_t first, size_t last) {
+    const auto& ys = _points->y;
+    if (first == last) {
+        _rangeMin[node] = std::min(ys[first], ys[first + 1]);
+        _rangeMax[node] = std::max(ys[first], ys[first + 1]);
+        return;
+    }
+
+    auto middle = (first + last) / 2;
+    BuildRangeTree(2 * node, first, middle);
+    BuildRangeTree(2 * node + 1, middle + 1, last);
+    _rangeMin[node] = std::min(_rangeMin[2 * node], _rangeMin[2 * node + 1]);
+    _rangeMax[node] = std::max(_rangeMax[2 * node], _rangeMax[2 * node + 1]);
+}
+
+bool CurveData::FindFirstSegment(size_t node, size_t first, size_t last, double value, size_t *segment) const {
+    // adjacent segments share a point, so the value is reached within a range of segments when it lies within
+    // the range of values of those segments
+    if (value < _rangeMin[node] || value > _rangeMax[node]) {
+        return false;
+    }
+
+    if (first == last) {
+        *segment = first;
+        return true;
+    }
+
+    auto middle = (first + last) / 2;
+    return FindFirstSegment(2 * node, first, middle, value, segment) ||
+           FindFirstSegment(2 * node + 1, middle + 1, last, value, segment);
+}
+
 PointPtr CurveData::GetInterpolated(double x) {
     return std::make_shared<Point>(x, GetInterpolatedValue(x));
 }
 
 double CurveData::GetStepValue(double x) {
-    if (_points->size() < 2) return _points->front()->GetY();
-    if (x <= GetBegin()) return _points->front()->GetY();
-    if (x >= GetEnd()) return _points->back()->GetY();
-
-    PointPtr start;
-    PointPtr end;
+    const auto& ys = _points->y;
+    if (ys.size() < 2) return ys.front();
+    if (x <= GetBegin()) return ys.front();
+    if (x >= GetEnd()) return ys.back();
 
-    GetStartAndEndPoint(x, &start, &end);
-    return start->GetY();
+    return ys[GetStartIndex(x)];
 }
 
-const CurveData &CurveData::Append(const CurveData &other) const {
+const CurveData &CurveData::Append(const CurveData &other) {
     auto offsetX = 0.0;
 
-    if (_points->size()) {
-        offsetX = _points->back()->GetX();
+    if (HasPoints()) {
+        offsetX = GetEnd();
     }
 
-    for (auto point : *other._points) {
-        _points->push_back(NEW_PTR(Point, point->GetX() + offsetX, point->GetY()));
+    // keep a reference, appending a curve to itself may replace the storage of other
+    auto source = other._points;
+    auto& arrays = GetMutablePoints();
+    const auto count = source->x.size();
+    arrays.x.reserve(arrays.x.size() + count);
+    arrays.y.reserve(arrays.y.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        arrays.x.push_back(source->x[i] + offsetX);
+        arrays.y.push_back(source->y[i]);
     }
 
     return *this;
 }
 
 void CurveData::AppendPoint(const PointPtr point) {
-    _points->push_back(point);
+    auto& arrays = GetMutablePoints();
+    arrays.x.push_back(point->GetX());
+    arrays.y.push_back(point->GetY());
 }
 
 void CurveData::AppendPointLinearized(const PointPtr point, double delta) {
-    if (_points->size() >= 2) {
-        auto last       = (*_points)[_points->size() - 1];
-        auto secondLast = (*_points)[_points->size() - 2];
-        auto y_inter = Interpolate(secondLast, point, last->GetX());
-        auto y_orig = last->GetY();
+    auto& arrays = GetMutablePoints();
+    const auto size = arrays.x.size();
+    if (size >= 2) {
+        auto y_inter = Interpolate(arrays.x[size - 2], arrays.y[size - 2], point->GetX(), point->GetY(), arrays.x[size - 1]);
+        auto y_orig = arrays.y[size - 1];
         if (std::abs(y_orig - y_inter) <= delta) {
-            _points->pop_back();
+            arrays.x.pop_back();
+            arrays.y.pop_back();
         }
     }
-    _points->push_back(point);
+    arrays.x.push_back(point->GetX());
+    arrays.y.push_back(point->GetY());
 }
 
 std::string CurveData::GetTypeName() const {
@@ -209,10 +326,9 @@ void CurveData::Serialize(JSONNode *node) const {
     }
 
     JSONNode arrayNode(JSON_ARRAY);
-    for (size_t i = 0; i < _points->size(); ++i) {
+    for (size_t i = 0; i < _points->x.size(); ++i) {
         JSONNode v;
-        auto p = _points->at(i);
-        p->Serialize(&v);
+        Point(_points->x[i], _points->y[i]).Serialize(&v);
         arrayNode.push_back(v);
     }
     arrayNode.set_name(AttributePoints);
@@ -224,20 +340,25 @@ void CurveData::Deserialize(JSONNode *node) {
 
     _options.clear_value();
     if (SerializerHelper::IsAttributeSet(node, AttributeOptions)) {
-        auto j = (*node)[AttributeOptions];
+        auto &j = (*node)[AttributeOptions];
         auto o = CurveOptions();
         o.Deserialize(&j);
         _options.set_value(o);
     }
 
-    _points->clear();
+    auto& arrays = GetMutablePoints();
+    arrays.x.clear();
+    arrays.y.clear();
     if (SerializerHelper::IsAttributeSet(node, AttributePoints)) {
-        auto j = (*node)[AttributePoints];
+        auto &j = (*node)[AttributePoints];
+        arrays.x.reserve(j.size());
+        arrays.y.reserve(j.size());
         for (auto pointIt = j.begin(); pointIt != j.end(); ++pointIt) {
-            auto pointJ = *pointIt;
-            auto p = NEW_PTR(Point);
-            p->Deserialize(&pointJ);
-            _points->push_back(p);
+            auto &pointJ = *pointIt;
+            auto p = Point();
+            p.Deserialize(&pointJ);
+            arrays.x.push_back(p.GetX());
+            arrays.y.push_back(p.GetY());
         }
     }
 }
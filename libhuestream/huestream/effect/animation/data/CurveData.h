@@ -11,18 +11,39 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace huestream {
 
+    /**
+     curve of points stored as contiguous arrays of x and y values
+     @note copies share the point storage until one of them is modified
+     */
     class CurveData : public virtual Serializable {
     public:
         static constexpr const char* type = "huestream.CurveData";
 
         PROP_DEFINE(CurveData, Nullable<CurveOptions>, options, Options);
-        PROP_DEFINE(CurveData, PointListPtr, points, Points);
 
     public:
+        static HUESTREAM_EXPORT std::string AttributePoints;
+
+        /**
+         get the points of this curve as a list of point objects
+         @note the list is built on first use after a change and shared by copies of this curve, treat it as read only
+         and use SetPoints() to change the points
+         */
+        const PointListPtr &GetPoints() const;
+
+        void SetPoints(const PointListPtr &points);
+
+        size_t GetPointCount() const;
+
+        const double* GetX() const;
+
+        const double* GetY() const;
+
         void Serialize(JSONNode *node) const override;
 
         void Deserialize(JSONNode *node) override;
@@ -41,6 +62,14 @@ namespace huestream {
 
         double GetStepValue(double x);
 
+        /**
+         get the first position at which the curve reaches a value
+         @note uses a tree of the value range of each segment, which is built on first use after a change, so lookups take O(log n)
+         @note the tree is kept per instance, copies sharing the point storage each build their own
+         @return false when the curve never reaches the value
+         */
+        bool GetPositionFromValue(double value, double *position);
+
         double GetLength() const;
 
         double GetBegin() const;
@@ -49,24 +78,42 @@ namespace huestream {
 
         bool HasPoints() const;
 
-        const CurveData &Append(const CurveData &other) const;
+        const CurveData &Append(const CurveData &other);
 
         void AppendPoint(const PointPtr Point);
 
         void AppendPointLinearized(const PointPtr Point, double delta = 0.000015);
 
     private:
+        struct PointArrays {
+            PointArrays();
+            PointArrays(const PointArrays &other);
+
+            std::vector<double> x;
+            std::vector<double> y;
+
+            std::mutex pointListLock;
+            PointListPtr pointList;
+        };
+
+        void BuildRangeTree(size_t node, size_t first, size_t last);
+
+        bool FindFirstSegment(size_t node, size_t first, size_t last, double value, size_t *segment) const;
+
         double CorrectValue(double v) const;
 
-        bool GetStartAndEndPoint(double x, PointPtr* start, PointPtr* end);
+        PointArrays& GetMutablePoints();
 
-        PointList::iterator GetStartPoint(double x);
+        size_t GetStartIndex(double x);
 
-        bool IsClosestLower(PointList::iterator it, double x);
+        bool IsClosestLower(size_t index, double x) const;
 
-        double Interpolate(PointPtr start, PointPtr end, double x);
+        static double Interpolate(double startX, double startY, double endX, double endY, double x);
 
-        unsigned int _lastIndex;
+        std::shared_ptr<PointArrays> _points;
+        std::vector<double> _rangeMin;
+        std::vector<double> _rangeMax;
+        size_t _lastIndex;
     };
 }  // namespace huestream
 
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/util/HueMath.h>
+#include <huestream/effect/animation/data/TweenKernel.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace huestream {
+
+    // c * t / d + b
+    template<>
+    double TweenKernel::Apply<TweenType::Linear>(const TweenKernel &kernel, double t) {
+        return kernel._change * t * kernel._scale + kernel._begin;
+    }
+
+    // both halves are computed and one is selected, to keep the batch loop free of branches
+    template<>
+    double TweenKernel::Apply<TweenType::EaseInOutQuad>(const TweenKernel &kernel, double t) {
+        auto u = t * kernel._scale;
+        auto v = u - 1;
+        auto easeIn = kernel._change * u * u;
+        auto easeOut = -kernel._change * (v * (v - 2) - 1);
+        return (u < 1 ? easeIn : easeOut) + kernel._begin;
+    }
+
+    template<>
+    double TweenKernel::Apply<TweenType::EaseInOutSine>(const TweenKernel &kernel, double t) {
+        return -kernel._change * (std::cos(t * kernel._scale) - 1) + kernel._begin;
+    }
+
+    template<TweenType Type>
+    double TweenKernel::EvaluateSingle(const TweenKernel &kernel, double t) {
+        auto value = Apply<Type>(kernel, t);
+        return t > kernel._time ? kernel._end : value;
+    }
+
+    template<TweenType Type>
+    void TweenKernel::EvaluateBatch(const TweenKernel &kernel, const double *t, double *out, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            auto value = Apply<Type>(kernel, t[i]);
+            out[i] = t[i] > kernel._time ? kernel._end : value;
+        }
+    }
+
+    // values which are this close to the begin or end value still count as reached
+    static const double InverseTolerance = 0.001;
+
+    TweenKernel::TweenKernel() : TweenKernel(TweenType::Linear, 0, 1, 1000) {
+    }
+
+    TweenKernel::TweenKernel(TweenType type, double begin, double end, double time) :
+            _type(type),
+            _begin(begin),
+            _end(end),
+            _time(time),
+            _change(end - begin),
+            _scale(1 / time),
+            _evaluate(&EvaluateSingle<TweenType::Linear>),
+            _evaluateBatch(&EvaluateBatch<TweenType::Linear>) {
+        switch (type) {
+            case TweenType::Linear:
+                break;
+            case TweenType::EaseInOutQuad:
+                _change = (end - begin) / 2;
+                _scale = 2 / time;
+                _evaluate = &EvaluateSingle<TweenType::EaseInOutQuad>;
+                _evaluateBatch = &EvaluateBatch<TweenType::EaseInOutQuad>;
+                break;
+            case TweenType::EaseInOutSine:
+                _change = (end - begin) / 2;
+                _scale = HueMath::pi() / time;
+                _evaluate = &EvaluateSingle<TweenType::EaseInOutSine>;
+                _evaluateBatch = &EvaluateBatch<TweenType::EaseInOutSine>;
+                break;
+        }
+    }
+
+    bool TweenKernel::Invert(double value, double *position) const {
+        auto change = _end - _begin;
+        if (std::abs(value - _begin) <= InverseTolerance && std::abs(change) <= InverseTolerance) {
+            *position = 0;
+            return true;
+        }
+
+        if (change == 0) {
+            return false;
+        }
+
+        // fraction of the change from begin to end value at which the value is reached
+        auto fraction = (value - _begin) / change;
+        auto tolerance = InverseTolerance / std::abs(change);
+        if (fraction < -tolerance || fraction > 1 + tolerance) {
+            return false;
+        }
+        fraction = std::min(std::max(fraction, 0.0), 1.0);
+
+        switch (_type) {
+            case TweenType::Linear:
+                *position = fraction * _time;
+                break;
+            case TweenType::EaseInOutQuad: {
+                auto u = 2 * fraction;
+                u = u < 1 ? std::sqrt(u) : 2 - std::sqrt(2 - u);
+                *position = u * _time / 2;
+                break;
+            }
+            case TweenType::EaseInOutSine:
+                *position = std::acos(1 - 2 * fraction) * _time / HueMath::pi();
+                break;
+        }
+        return true;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_EFFECT_ANIMATION_DATA_TWEENKERNEL_H_
+#define HUESTREAM_EFFECT_ANIMATION_DATA_TWEENKERNEL_H_
+
+#include "huestream/effect/animation/data/TweenType.h"
+
+#include <stddef.h>
+
+namespace huestream {
+
+    /**
+     tween trajectory compiled for a fixed begin value, end value and duration
+     @note coefficients and reciprocals are computed once, so evaluating is a single indirect call without divisions
+     */
+    class TweenKernel {
+    public:
+        TweenKernel();
+
+        TweenKernel(TweenType type, double begin, double end, double time);
+
+        /**
+         get the value at a position in milliseconds, positions beyond the duration give the end value
+         */
+        double Evaluate(double t) const {
+            return _evaluate(*this, t);
+        }
+
+        /**
+         get the values at a number of positions in milliseconds
+         @note the loop has no branches or calls for linear and quadratic trajectories, so it can be vectorized
+         */
+        void Evaluate(const double *t, double *out, size_t count) const {
+            _evaluateBatch(*this, t, out, count);
+        }
+
+        /**
+         get the position in milliseconds at which a value is reached, computed in closed form
+         @return false when the value is not between the begin and end value
+         */
+        bool Invert(double value, double *position) const;
+
+    private:
+        typedef double (*EvaluateFunction)(const TweenKernel &kernel, double t);
+        typedef void (*EvaluateBatchFunction)(const TweenKernel &kernel, const double *t, double *out, size_t count);
+
+        template<TweenType Type>
+        static double Apply(const TweenKernel &kernel, double t);
+
+        template<TweenType Type>
+        static double EvaluateSingle(const TweenKernel &kernel, double t);
+
+        template<TweenType Type>
+        static void EvaluateBatch(const TweenKernel &kernel, const double *t, double *out, size_t count);
+
+        TweenType _type;
+        double _begin;
+        double _end;
+        double _time;
+        double _change;
+        double _scale;
+        EvaluateFunction _evaluate;
+        EvaluateBatchFunction _evaluateBatch;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_ANIMATION_DATA_TWEENKERNEL_H_
@@ -6,8 +6,10 @@
 #include <huestream/effect/animation/animations/ConstantAnimation.h>
 #include <huestream/effect/effects/AreaEffect.h>
 
+#include <algorithm>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace huestream {
 
@@ -32,6 +34,42 @@ namespace huestream {
         return Color();
     }
 
+    void AreaEffect::GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) {
+        auto color = Color(_r->GetValue(), _g->GetValue(), _b->GetValue(), _a->GetValue());
+        SetIntensity(&color);
+
+        const auto count = lights.Size();
+        const auto x = lights.GetX();
+        const auto y = lights.GetY();
+        const auto z = lights.GetZ();
+        std::fill(r, r + count, 0.0);
+        std::fill(g, g + count, 0.0);
+        std::fill(b, b + count, 0.0);
+        std::fill(a, a + count, 0.0);
+
+        auto min = Location();
+        auto max = Location();
+        for (const auto& area : *_areas) {
+            _lightIndices.clear();
+            if (area->GetBounds(&min, &max)) {
+                lights.GetSpatialIndex().QueryBox(min, max, &_lightIndices);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    _lightIndices.push_back(i);
+                }
+            }
+
+            for (auto i : _lightIndices) {
+                if (area->isInArea(Location(x[i], y[i], z[i]))) {
+                    r[i] = color.GetR();
+                    g[i] = color.GetG();
+                    b[i] = color.GetB();
+                    a[i] = color.GetAlpha();
+                }
+            }
+        }
+    }
+
 
     void AreaEffect::RenderUpdate() {
     }
@@ -34,9 +34,13 @@ namespace huestream {
 
         Color GetColor(LightPtr light) override;
 
+        void GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) override;
+
     protected:
         void RenderUpdate() override;
 
+        std::vector<size_t> _lightIndices;
+
     public:
         /**
          constructor
@@ -115,10 +115,10 @@ void LightIteratorEffect::CreateAnimations(GroupPtr group) {
             a->Append(before);
         }
 
-        r->Append(_r->Clone());
-        g->Append(_g->Clone());
-        b->Append(_b->Clone());
-        a->Append(_a->Clone());
+        r->Append(GetLightAnimation(_r));
+        g->Append(GetLightAnimation(_g));
+        b->Append(GetLightAnimation(_b));
+        a->Append(GetLightAnimation(_a));
 
         if (i != lights->size() - 1) {
             auto after = make_shared<TweenAnimation>(0, 0, (lights->size() - 1 - i) * _offset, TweenType::Linear);
@@ -138,10 +138,10 @@ void LightIteratorEffect::CreateAnimations(GroupPtr group) {
                 a->Append(beforeBounce);
             }
 
-            r->Append(_r->Clone());
-            g->Append(_g->Clone());
-            b->Append(_b->Clone());
-            a->Append(_a->Clone());
+            r->Append(GetLightAnimation(_r));
+            g->Append(GetLightAnimation(_g));
+            b->Append(GetLightAnimation(_b));
+            a->Append(GetLightAnimation(_a));
 
             if (i != 0) {
                 auto afterBounce = make_shared<TweenAnimation>(0, 0, i * _offset, TweenType::Linear);
@@ -157,6 +157,12 @@ void LightIteratorEffect::CreateAnimations(GroupPtr group) {
     }
 }
 
+AnimationPtr LightIteratorEffect::GetLightAnimation(const AnimationPtr &animation) const {
+    // the sequence of each light reads the value right after setting the marker, so an animation whose value only
+    // depends on the marker can be shared by all lights instead of being cloned for each of them
+    return animation->IsStateless() ? animation : animation->Clone();
+}
+
 void LightIteratorEffect::RenderUpdate() {
 }
 
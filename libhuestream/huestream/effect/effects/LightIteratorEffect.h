@@ -96,6 +96,8 @@ namespace huestream {
     protected:
         void CreateAnimations(GroupPtr group);
 
+        AnimationPtr GetLightAnimation(const AnimationPtr &animation) const;
+
         void RenderUpdate() override;
 
         void SerializeOrder(JSONNode *node) const;
@@ -9,6 +9,8 @@
 #include <huestream/effect/effects/LightSourceEffect.h>
 #include <huestream/effect/animation/animations/base/AnimationHelper.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -52,6 +54,49 @@ namespace huestream {
         return outputColor;
     }
 
+    void LightSourceEffect::GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) {
+        auto radius = _radius->GetValue();
+        auto sourceX = _x->GetValue();
+        auto sourceY = _y->GetValue();
+        auto currentAlpha = _a->GetValue();
+        auto color = Color(_r->GetValue(), _g->GetValue(), _b->GetValue(), 0);
+        SetIntensity(&color);
+
+        const auto count = lights.Size();
+        std::fill(r, r + count, color.GetR());
+        std::fill(g, g + count, color.GetG());
+        std::fill(b, b + count, color.GetB());
+
+        if (_opacityBoundToIntensity) {
+            std::fill(a, a + count, color.GetAlpha());
+            return;
+        }
+
+        // lights outside the radius are fully transparent, so only the lights inside it need to be evaluated
+        std::fill(a, a + count, 0.0);
+        if (radius <= 0) {
+            return;
+        }
+
+        const auto x = lights.GetX();
+        const auto y = lights.GetY();
+        _lightIndices.clear();
+        lights.GetSpatialIndex().QueryCircle(sourceX, sourceY, radius, &_lightIndices);
+        for (auto i : _lightIndices) {
+            auto dx = x[i] - sourceX;
+            auto dy = y[i] - sourceY;
+            auto vecLen = std::sqrt(dx * dx + dy * dy);
+            a[i] = HueMath::easeInQuad(vecLen, 1, 0, radius) * currentAlpha;
+        }
+    }
+
+    void LightSourceEffect::BakeAnimations(const AnimationBaker &baker) {
+        ColorAnimationEffect::BakeAnimations(baker);
+        _x = baker.Bake(_x);
+        _y = baker.Bake(_y);
+        _radius = baker.Bake(_radius);
+    }
+
     AnimationListPtr LightSourceEffect::GetAnimations() {
         auto list = ColorAnimationEffect::GetAnimations();
         list->push_back(_x);
@@ -41,6 +41,16 @@ void MultiChannelEffect::Clear() {
     _lightIdChannelMap->clear();
 }
 
+void MultiChannelEffect::BakeAnimations(const AnimationBaker &baker) {
+    AnimationEffect::BakeAnimations(baker);
+    for (auto channel : *_channels) {
+        channel->SetR(baker.Bake(channel->GetR()));
+        channel->SetG(baker.Bake(channel->GetG()));
+        channel->SetB(baker.Bake(channel->GetB()));
+        channel->SetA(baker.Bake(channel->GetA()));
+    }
+}
+
 AnimationListPtr MultiChannelEffect::GetAnimations() {
     auto animations = std::make_shared<AnimationList>();
     for (auto channel : *_channels) {
@@ -35,6 +35,8 @@ namespace huestream {
 
         AnimationListPtr GetAnimations() override;
 
+        void BakeAnimations(const AnimationBaker &baker) override;
+
         void Enable() override;
 
         void UpdateGroup(GroupPtr group) override;
@@ -32,6 +32,7 @@ namespace huestream {
         for (auto light : *_group->GetLights()) {
             if (area.isInArea(light->GetPosition())) {
                 found = true;
+                break;
             }
         }
 
@@ -9,6 +9,8 @@
 #include <huestream/effect/effects/SphereLightSourceEffect.h>
 #include <huestream/effect/animation/animations/base/AnimationHelper.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -51,6 +53,51 @@ namespace huestream {
         return outputColor;
     }
 
+    void SphereLightSourceEffect::GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) {
+        auto radius = _radius->GetValue();
+        auto sourcePosition = Location(_x->GetValue(), _y->GetValue(), _z->GetValue());
+        auto currentAlpha = _a->GetValue();
+        auto color = Color(_r->GetValue(), _g->GetValue(), _b->GetValue(), 0);
+        SetIntensity(&color);
+
+        const auto count = lights.Size();
+        std::fill(r, r + count, color.GetR());
+        std::fill(g, g + count, color.GetG());
+        std::fill(b, b + count, color.GetB());
+
+        if (_opacityBoundToIntensity) {
+            std::fill(a, a + count, color.GetAlpha());
+            return;
+        }
+
+        // lights outside the radius are fully transparent, so only the lights inside it need to be evaluated
+        std::fill(a, a + count, 0.0);
+        if (radius <= 0) {
+            return;
+        }
+
+        const auto x = lights.GetX();
+        const auto y = lights.GetY();
+        const auto z = lights.GetZ();
+        _lightIndices.clear();
+        lights.GetSpatialIndex().QuerySphere(sourcePosition, radius, &_lightIndices);
+        for (auto i : _lightIndices) {
+            auto dx = x[i] - sourcePosition.GetX();
+            auto dy = y[i] - sourcePosition.GetY();
+            auto dz = z[i] - sourcePosition.GetZ();
+            auto distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+            a[i] = HueMath::easeInQuad(distance, 1, 0, radius) * currentAlpha;
+        }
+    }
+
+    void SphereLightSourceEffect::BakeAnimations(const AnimationBaker &baker) {
+        ColorAnimationEffect::BakeAnimations(baker);
+        _x = baker.Bake(_x);
+        _y = baker.Bake(_y);
+        _z = baker.Bake(_z);
+        _radius = baker.Bake(_radius);
+    }
+
     AnimationListPtr SphereLightSourceEffect::GetAnimations() {
         auto list = ColorAnimationEffect::GetAnimations();
         list->push_back(_x);
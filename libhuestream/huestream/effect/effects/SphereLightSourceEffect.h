@@ -12,6 +12,7 @@
 #include "huestream/effect/effects/base/ColorAnimationEffect.h"
 
 #include <string>
+#include <vector>
 
 namespace huestream {
 
@@ -61,9 +62,16 @@ namespace huestream {
 
         Color GetColor(LightPtr light) override;
 
+        void GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) override;
+
         void RenderUpdate() override;
 
         AnimationListPtr GetAnimations() override;
+
+        void BakeAnimations(const AnimationBaker &baker) override;
+
+    protected:
+        std::vector<size_t> _lightIndices;
     };
 }  // namespace huestream
 
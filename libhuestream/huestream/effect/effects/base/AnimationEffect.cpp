@@ -79,6 +79,10 @@ namespace huestream {
         return GetLength() == INF;
     }
 
+    void AnimationEffect::BakeAnimations(const AnimationBaker &baker) {
+        _speed = baker.Bake(_speed);
+    }
+
     void AnimationEffect::SetSpeedAnimation(AnimationPtr speed) {
         _speed = speed;
     }
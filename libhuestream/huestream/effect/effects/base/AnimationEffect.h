@@ -8,6 +8,7 @@
 
 #include "huestream/effect/effects/base/Effect.h"
 #include "huestream/effect/animation/Player.h"
+#include "huestream/effect/animation/AnimationBaker.h"
 #include "huestream/common/time/ITimeProvider.h"
 
 #include <string>
@@ -74,6 +75,13 @@ namespace huestream {
          */
         virtual bool IsEndless();
 
+        /**
+         replace the animations of this effect by their baked version where possible
+         @note should be called before the effect is enabled
+         @param baker Baker which determines frame rate and tolerance
+         */
+        virtual void BakeAnimations(const AnimationBaker &baker);
+
         void Enable() override;
 
         void Disable() override;
@@ -53,6 +53,15 @@ namespace huestream {
         SetOpacityAnimation(std::make_shared<ConstantAnimation>(opacity));
     }
 
+    void ColorAnimationEffect::BakeAnimations(const AnimationBaker &baker) {
+        AnimationEffect::BakeAnimations(baker);
+        _r = baker.Bake(_r);
+        _g = baker.Bake(_g);
+        _b = baker.Bake(_b);
+        _a = baker.Bake(_a);
+        _i = baker.Bake(_i);
+    }
+
     AnimationListPtr ColorAnimationEffect::GetAnimations() {
         if (_i != nullptr)
             return AnimationHelper::CreatePtr(_r, _g, _b, _a, _i);
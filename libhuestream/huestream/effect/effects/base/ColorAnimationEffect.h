@@ -74,6 +74,8 @@ namespace huestream {
          */
         void SetFixedOpacity(double opacity);
 
+        void BakeAnimations(const AnimationBaker &baker) override;
+
         void Serialize(JSONNode *node) const override;
 
         void Deserialize(JSONNode *node) override;
@@ -30,6 +30,16 @@ namespace huestream {
     void Effect::UpdateGroup(GroupPtr /*group*/) {
     }
 
+    void Effect::GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) {
+        for (size_t i = 0; i < lights.Size(); ++i) {
+            auto color = GetColor(lights.GetLight(i));
+            r[i] = color.GetR();
+            g[i] = color.GetG();
+            b[i] = color.GetB();
+            a[i] = color.GetAlpha();
+        }
+    }
+
     bool Effect::IsFinished() const {
         return _state == State::Finished;
     }
@@ -10,6 +10,7 @@
 #include "huestream/common/serialize/Serializable.h"
 #include "huestream/common/data/Color.h"
 #include "huestream/common/data/Light.h"
+#include "huestream/common/data/LightBuffer.h"
 #include "huestream/common/data/Group.h"
 #include "huestream/common/time/ITimeProvider.h"
 
@@ -55,6 +56,19 @@ namespace huestream {
          */
         virtual Color GetColor(LightPtr light) = 0;
 
+        /**
+         effects may override this method to map all lights to colors at once
+         @note gets called once per render cycle instead of GetColor(), the default implementation calls GetColor() per light
+         @note with more than one render thread (AppSettings::SetRenderThreads) the effects are evaluated in parallel, so this
+         method, or GetColor() when it is not overridden, must be thread safe with respect to other effects
+         @param lights Ids and positions of all lights
+         @param r Output array of red values, one per light
+         @param g Output array of green values, one per light
+         @param b Output array of blue values, one per light
+         @param a Output array of opacity values, one per light
+         */
+        virtual void GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a);
+
         /**
          set effect state to enabled, i.e. it is being rendered
          */
@@ -8,14 +8,17 @@
 #include <huestream/effect/animation/ActionPlayer.h>
 #include <huestream/effect/effects/AreaEffect.h>
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <limits>
 
 namespace huestream {
 
-    PROP_IMPL(Action, int64_t, startPosition, StartPosition);
-    PROP_IMPL(Action, int64_t, endPosition, EndPosition);
+    static std::atomic<uint64_t> scheduleGeneration(0);
+
+    PROP_IMPL_ON_UPDATE_CALL(Action, int64_t, startPosition, StartPosition, OnUpdatePosition);
+    PROP_IMPL_ON_UPDATE_CALL(Action, int64_t, endPosition, EndPosition, OnUpdatePosition);
     PROP_IMPL_ON_UPDATE_CALL(Action, AnimationEffectPtr, effect, Effect, OnUpdateEffect);
 
     Action::Action() : Action("", 0, nullptr, 0, -1) {}
@@ -31,6 +34,11 @@ namespace huestream {
 
     void Action::SetTimeProvider(TimeProviderPtr timeProvider) {
         _timeProvider = timeProvider;
+        InvalidateSchedules();
+    }
+
+    TimeProviderPtr Action::GetTimeProvider() const {
+        return _timeProvider;
     }
 
     void Action::OnUpdateEffect() {
@@ -38,6 +46,19 @@ namespace huestream {
             _effect->SetPlayer(_actionplayer);
             _effect->Enable();
         }
+        InvalidateSchedules();
+    }
+
+    void Action::OnUpdatePosition() {
+        InvalidateSchedules();
+    }
+
+    void Action::InvalidateSchedules() {
+        scheduleGeneration++;
+    }
+
+    uint64_t Action::GetScheduleGeneration() {
+        return scheduleGeneration;
     }
 
     int64_t Action::GetCalculatedEndPosition() const {
@@ -68,6 +89,8 @@ namespace huestream {
         if (_effect != nullptr) {
             _effect->UpdateGroup(group);
         }
+        // the length of the effect can depend on the lights in the group
+        InvalidateSchedules();
     }
 
     void Action::Render() {
@@ -109,6 +132,7 @@ namespace huestream {
         _startPosition = static_cast<int64_t>(value);
         DeserializeValue(node, AttributeEndPosition, &value, -1);
         _endPosition = static_cast<int64_t>(value);
+        InvalidateSchedules();
 
         auto effect = DeserializeAttribute<AnimationEffect>(node, AttributeEffect, _effect);
         SetEffect(effect);
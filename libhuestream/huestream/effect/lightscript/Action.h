@@ -44,6 +44,10 @@ class Action : public Effect {
 
     void OnUpdateEffect();
 
+    void OnUpdatePosition();
+
+    static void InvalidateSchedules();
+
 public:
     static constexpr const char* type = "huestream.Action";
 
@@ -66,14 +70,27 @@ public:
 
     /**
      set object which provides the time position
+     @note can also be set after adding the action to the engine, it is then rescheduled on the next render
      */
     void SetTimeProvider(TimeProviderPtr timeProvider);
 
+    /**
+     get object which provides the time position
+     */
+    TimeProviderPtr GetTimeProvider() const;
+
     /**
      get the calculated end position of this action based on the set end position and duration of the underlying effect (whichever ends first)
      */
     int64_t GetCalculatedEndPosition() const;
 
+    /**
+     get a counter which changes whenever the period in which any action is active or its time provider may have changed
+     @note the mixer compares it once per frame to reschedule its actions, it does not see changes made to the animations
+     of an effect after it was set, set the effect again after changing its length
+     */
+    static uint64_t GetScheduleGeneration();
+
     Color GetColor(LightPtr light) override;
 
     void UpdateGroup(GroupPtr group) override;
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/lightscript/ActionScheduler.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace huestream {
+
+    ActionScheduler::ActionScheduler() {
+    }
+
+    void ActionScheduler::Build(const ActionList &actions) {
+        _intervals.clear();
+        _intervals.reserve(actions.size());
+        for (size_t i = 0; i < actions.size(); ++i) {
+            _intervals.push_back({actions[i]->GetStartPosition(), actions[i]->GetCalculatedEndPosition(), i});
+        }
+
+        std::sort(_intervals.begin(), _intervals.end(), [](const Interval &a, const Interval &b) {
+            return a.start < b.start;
+        });
+
+        _maxEnd.assign(_intervals.size(), 0);
+        BuildMaxEnd(0, _intervals.size());
+    }
+
+    void ActionScheduler::GetActiveActions(int64_t position, std::vector<size_t> *indices) const {
+        Find(0, _intervals.size(), position, indices);
+    }
+
+    size_t ActionScheduler::Size() const {
+        return _intervals.size();
+    }
+
+    int64_t ActionScheduler::BuildMaxEnd(size_t begin, size_t end) {
+        if (begin >= end) {
+            return std::numeric_limits<int64_t>::min();
+        }
+
+        // the middle of a range is the root of its subtree and stores the largest end position in the subtree
+        auto middle = begin + (end - begin) / 2;
+        _maxEnd[middle] = std::max(_intervals[middle].end,
+                                   std::max(BuildMaxEnd(begin, middle), BuildMaxEnd(middle + 1, end)));
+        return _maxEnd[middle];
+    }
+
+    void ActionScheduler::Find(size_t begin, size_t end, int64_t position, std::vector<size_t> *indices) const {
+        if (begin >= end) {
+            return;
+        }
+
+        auto middle = begin + (end - begin) / 2;
+        if (_maxEnd[middle] <= position) {
+            return;
+        }
+
+        Find(begin, middle, position, indices);
+
+        // an action is active strictly between its start and end position, same as Action::IsEnabled()
+        const auto &interval = _intervals[middle];
+        if (interval.start >= position) {
+            return;
+        }
+        if (interval.end > position) {
+            indices->push_back(interval.index);
+        }
+
+        Find(middle + 1, end, position, indices);
+    }
+
+}  // namespace huestream
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+/** @file */
+
+#ifndef HUESTREAM_EFFECT_LIGHTSCRIPT_ACTIONSCHEDULER_H_
+#define HUESTREAM_EFFECT_LIGHTSCRIPT_ACTIONSCHEDULER_H_
+
+#include "huestream/effect/lightscript/Action.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace huestream {
+
+    /**
+     interval tree over the periods in which huestream::Action s are active, to find the actions overlapping a timeline position without checking every action
+     @note the tree is stored as a list sorted on start position, so a lookup at any position (e.g. after a seek) takes O(log n) plus the number of active actions
+     */
+    class ActionScheduler {
+    public:
+        ActionScheduler();
+
+        /**
+         index the start and calculated end positions of a list of actions
+         @note positions are read once, so rebuild when Action::GetScheduleGeneration() changes
+         */
+        void Build(const ActionList &actions);
+
+        /**
+         get the actions which are active at a position
+         @param position Position in milliseconds
+         @param indices Indices in the list passed to Build() of the active actions are appended to this list
+         */
+        void GetActiveActions(int64_t position, std::vector<size_t> *indices) const;
+
+        /**
+         get number of indexed actions
+         */
+        size_t Size() const;
+
+    private:
+        struct Interval {
+            int64_t start;
+            int64_t end;
+            size_t index;
+        };
+
+        int64_t BuildMaxEnd(size_t begin, size_t end);
+
+        void Find(size_t begin, size_t end, int64_t position, std::vector<size_t> *indices) const;
+
+        std::vector<Interval> _intervals;
+        std::vector<int64_t> _maxEnd;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_LIGHTSCRIPT_ACTIONSCHEDULER_H_
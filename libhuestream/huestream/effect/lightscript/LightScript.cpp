@@ -5,6 +5,7 @@
 
 #include <huestream/effect/lightscript/LightScript.h>
 
+#include <algorithm>
 #include <string>
 #include <memory>
 
@@ -40,11 +41,11 @@ namespace huestream {
     }
 
     void LightScript::UpdateActions() {
-        auto actionsCopy = std::make_shared<ActionList>(*_actions);
-        _actions->clear();
+        // a stable sort keeps actions with equal layer and start position in the order they were added
+        std::stable_sort(_actions->begin(), _actions->end(), IsOrderedBefore);
 
-        for (auto action : *actionsCopy) {
-            AddAction(action);
+        for (auto action : *_actions) {
+            action->SetTimeProvider(_timeline);
         }
     }
 
@@ -65,21 +66,29 @@ namespace huestream {
         }
     }
 
-    int LightScript::FindActionIndex(const ActionPtr &newEffect) const {
-        auto i = 0;
-
+    void LightScript::BakeAnimations(const AnimationBaker &baker) {
         for (auto action : *_actions) {
-            auto newStartPosition = newEffect->GetStartPosition();
-            auto startPosition = action->GetStartPosition();
-            auto newLayer = newEffect->GetLayer();
-            auto layer = action->GetLayer();
-            if (newLayer < layer || (newStartPosition < startPosition && newLayer == layer)) {
-                break;
+            auto effect = action->GetEffect();
+            if (effect != nullptr) {
+                effect->BakeAnimations(baker);
             }
-            i++;
         }
+    }
+
+    int LightScript::FindActionIndex(const ActionPtr &newEffect) const {
+        // actions are kept sorted, so actions loaded in order are appended without scanning the list
+        if (_actions->empty() || !IsOrderedBefore(newEffect, _actions->back())) {
+            return static_cast<int>(_actions->size());
+        }
+
+        auto it = std::upper_bound(_actions->begin(), _actions->end(), newEffect, IsOrderedBefore);
+        return static_cast<int>(it - _actions->begin());
+    }
 
-        return i;
+    bool LightScript::IsOrderedBefore(const ActionPtr &action, const ActionPtr &other) {
+        auto layer = action->GetLayer();
+        auto otherLayer = other->GetLayer();
+        return layer < otherLayer || (layer == otherLayer && action->GetStartPosition() < other->GetStartPosition());
     }
 
     std::string LightScript::GetTypeName() const {
@@ -151,16 +160,16 @@ namespace huestream {
     void LightScript::DeserializeLayers(JSONNode *node) {
         auto currentLayer = 0;
         if (SerializerHelper::IsAttributeSet(node, "layers")) {
-            auto layersNode = (*node)["layers"];
+            auto &layersNode = (*node)["layers"];
             for (auto layerIt = layersNode.begin(); layerIt != layersNode.end(); ++layerIt) {
-                JSONNode layerNode = *layerIt;
+                JSONNode &layerNode = *layerIt;
                 if (SerializerHelper::IsAttributeSet(&layerNode, "layer")) {
                     DeserializeValue(&layerNode, "layer", &currentLayer, 0);
                 }
                 if (SerializerHelper::IsAttributeSet(&layerNode, "timeline")) {
-                    auto timelineNode = (layerNode)["timeline"];
+                    auto &timelineNode = layerNode["timeline"];
                     for (auto actionIt = timelineNode.begin(); actionIt != timelineNode.end(); ++actionIt) {
-                        JSONNode actionNode = *actionIt;
+                        JSONNode &actionNode = *actionIt;
                         auto action = std::static_pointer_cast<Action>(DeserializeFromJson(&actionNode));
                         action->SetLayer(static_cast<unsigned int>(currentLayer));
                         AddAction(action);
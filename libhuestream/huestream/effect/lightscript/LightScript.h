@@ -52,6 +52,13 @@ namespace huestream {
          */
         void Finish();
 
+        /**
+         replace the animations of all effects in this light script by their baked version where possible
+         @note should be called before the timeline starts playing
+         @see AnimationEffect::BakeAnimations()
+         */
+        void BakeAnimations(const AnimationBaker &baker);
+
         /**
          get the previously bound timeline
          */
@@ -90,6 +97,8 @@ namespace huestream {
 
         int FindActionIndex(const ActionPtr &newAction) const;
 
+        static bool IsOrderedBefore(const ActionPtr &action, const ActionPtr &other);
+
         void UpdateActions();
 
         TimelinePtr _timeline;
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/lightscript/LightScriptStream.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace huestream {
+
+    static const char *AttributeLayers = "layers";
+    static const char *AttributeLayer = "layer";
+    static const char *AttributeTimeline = "timeline";
+
+    LightScriptStream::LightScriptStream(const std::string &fileName, int64_t lookahead) :
+        _file(fileName),
+        _lookahead(lookahead),
+        _script(std::make_shared<LightScript>()),
+        _next(0),
+        _position(0),
+        _valid(false) {
+        _valid = Open();
+    }
+
+    bool LightScriptStream::IsValid() const {
+        return _valid;
+    }
+
+    LightScriptPtr LightScriptStream::GetScript() const {
+        return _script;
+    }
+
+    void LightScriptStream::BindTimeline(TimelinePtr timeline) {
+        _script->BindTimeline(timeline);
+    }
+
+    TimelinePtr LightScriptStream::GetTimeline() const {
+        return _script->GetTimeline();
+    }
+
+    ActionListPtr LightScriptStream::Update() {
+        auto timeline = _script->GetTimeline();
+        if (timeline == nullptr) {
+            return std::make_shared<ActionList>();
+        }
+        return Update(timeline->Now());
+    }
+
+    ActionListPtr LightScriptStream::Update(int64_t position) {
+        auto loaded = std::make_shared<ActionList>();
+        if (position < _position) {
+            Rewind();
+        }
+        _position = position;
+
+        Release(position);
+
+        while (_next < _entries.size() && _entries[_next].startPosition <= position + _lookahead) {
+            auto &entry = _entries[_next++];
+            if (entry.endPosition != UnknownEndPosition && entry.endPosition <= position) {
+                continue;
+            }
+
+            auto action = Load(&entry);
+            if (action != nullptr && entry.endPosition > position) {
+                _script->AddAction(action);
+                loaded->push_back(action);
+            }
+        }
+
+        return loaded;
+    }
+
+    bool LightScriptStream::IsEnded() const {
+        return _next == _entries.size() && _script->GetActions()->empty();
+    }
+
+    size_t LightScriptStream::GetActionCount() const {
+        return _entries.size();
+    }
+
+    int64_t LightScriptStream::GetLookahead() const {
+        return _lookahead;
+    }
+
+    void LightScriptStream::SetLookahead(int64_t lookahead) {
+        _lookahead = lookahead;
+    }
+
+    bool LightScriptStream::Open() {
+        auto root = BinaryNode::Open(_file.GetData(), _file.GetSize());
+        if (root.GetType() != BinaryNode::Type::Object ||
+            root.Find(Serializable::AttributeType).AsString() != LightScript::type ||
+            root.Find(LightScript::AttributeVersionMajor).AsNumber() > LightScript::majorVersion) {
+            return false;
+        }
+
+        // deserialize the metadata only, the actions are indexed to be loaded when needed
+        JSONNode metadata(JSON_NODE);
+        for (size_t i = 0; i < root.Size(); ++i) {
+            auto name = root.GetName(i);
+            if (name == nullptr || std::string(name) == AttributeLayers) {
+                continue;
+            }
+            auto child = root.At(i).ToJson();
+            child.set_name(name);
+            metadata.push_back(child);
+        }
+        _script->Deserialize(&metadata);
+
+        IndexLayers(root.Find(AttributeLayers));
+        return true;
+    }
+
+    void LightScriptStream::IndexLayers(const BinaryNode &layers) {
+        unsigned int currentLayer = 0;
+        for (size_t i = 0; i < layers.Size(); ++i) {
+            auto layer = layers.At(i);
+            auto layerId = layer.Find(AttributeLayer);
+            if (layerId.IsValid()) {
+                currentLayer = static_cast<unsigned int>(layerId.AsNumber());
+            }
+
+            auto timeline = layer.Find(AttributeTimeline);
+            for (size_t j = 0; j < timeline.Size(); ++j) {
+                auto action = timeline.At(j);
+                auto startPosition = static_cast<int64_t>(action.Find(Action::AttributeStartPosition).AsNumber());
+                _entries.push_back({startPosition, UnknownEndPosition, currentLayer, action});
+            }
+        }
+
+        // a stable sort keeps the layer order of actions with the same start position
+        std::stable_sort(_entries.begin(), _entries.end(), [](const Entry &a, const Entry &b) {
+            return a.startPosition < b.startPosition;
+        });
+    }
+
+    ActionPtr LightScriptStream::Load(Entry *entry) {
+        auto node = entry->node.ToJson();
+        auto serializable = Serializable::DeserializeFromJson(&node);
+        if (serializable == nullptr || serializable->GetTypeName() != Action::type) {
+            entry->endPosition = entry->startPosition;
+            return nullptr;
+        }
+
+        auto action = std::static_pointer_cast<Action>(serializable);
+        action->SetLayer(entry->layer);
+        entry->endPosition = action->GetCalculatedEndPosition();
+        return action;
+    }
+
+    void LightScriptStream::Rewind() {
+        _script->Finish();
+        _script->GetActions()->clear();
+        _next = 0;
+    }
+
+    void LightScriptStream::Release(int64_t position) {
+        auto actions = _script->GetActions();
+        auto ended = std::remove_if(actions->begin(), actions->end(), [position](const ActionPtr &action) {
+            if (action->GetCalculatedEndPosition() > position) {
+                return false;
+            }
+            action->Finish();
+            return true;
+        });
+        actions->erase(ended, actions->end());
+    }
+
+}  // namespace huestream
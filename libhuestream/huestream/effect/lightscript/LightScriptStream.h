@@ -0,0 +1,125 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+/** @file */
+
+#ifndef HUESTREAM_EFFECT_LIGHTSCRIPT_LIGHTSCRIPTSTREAM_H_
+#define HUESTREAM_EFFECT_LIGHTSCRIPT_LIGHTSCRIPTSTREAM_H_
+
+#include "huestream/common/serialize/BinaryNode.h"
+#include "huestream/common/storage/MappedFile.h"
+#include "huestream/effect/lightscript/LightScript.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     plays a huestream::LightScript from a binary container file without loading all actions up front
+     @note only actions which start within the lookahead window of the timeline position are deserialized, actions which have ended are finished and released, so memory stays bounded for long scripts
+     @note the file is memory mapped and indexed on construction, playback can start as soon as the first window has been loaded by Update()
+     @see BinaryFileStorageAccessor
+     */
+    class LightScriptStream {
+    public:
+        /**
+         constructor
+         @param fileName Binary container file with a serialized light script
+         @param lookahead Time in milliseconds that actions are loaded before their start position
+         */
+        explicit LightScriptStream(const std::string &fileName, int64_t lookahead = 5000);
+
+        LightScriptStream(const LightScriptStream &) = delete;
+
+        LightScriptStream &operator=(const LightScriptStream &) = delete;
+
+        /**
+         check whether the file contains a compatible light script
+         */
+        bool IsValid() const;
+
+        /**
+         get the light script with the metadata of the file and the currently loaded actions
+         */
+        LightScriptPtr GetScript() const;
+
+        /**
+         bind this stream to a timeline which determines which actions are loaded
+         */
+        void BindTimeline(TimelinePtr timeline);
+
+        /**
+         get the previously bound timeline
+         */
+        TimelinePtr GetTimeline() const;
+
+        /**
+         load and release actions for the current position of the bound timeline
+         @return actions which have been loaded by this call, to be added to the engine
+         */
+        ActionListPtr Update();
+
+        /**
+         load and release actions for a certain timeline position
+         @note seeking backwards reloads actions from the file, actions which are known to have ended before the position are skipped
+         @return actions which have been loaded by this call, to be added to the engine
+         */
+        ActionListPtr Update(int64_t position);
+
+        /**
+         check whether all actions of the file have been loaded and released again
+         */
+        bool IsEnded() const;
+
+        /**
+         get total number of actions in the file
+         */
+        size_t GetActionCount() const;
+
+        int64_t GetLookahead() const;
+
+        void SetLookahead(int64_t lookahead);
+
+    private:
+        struct Entry {
+            int64_t startPosition;
+            int64_t endPosition;
+            unsigned int layer;
+            BinaryNode node;
+        };
+
+        static constexpr int64_t UnknownEndPosition = -1;
+
+        bool Open();
+
+        void IndexLayers(const BinaryNode &layers);
+
+        ActionPtr Load(Entry *entry);
+
+        void Rewind();
+
+        void Release(int64_t position);
+
+        MappedFile _file;
+        int64_t _lookahead;
+        LightScriptPtr _script;
+        std::vector<Entry> _entries;
+        size_t _next;
+        int64_t _position;
+        bool _valid;
+    };
+
+    /**
+     shared pointer to a huestream::LightScriptStream object
+     */
+    typedef std::shared_ptr<LightScriptStream> LightScriptStreamPtr;
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_EFFECT_LIGHTSCRIPT_LIGHTSCRIPTSTREAM_H_
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/ConnectBackoff.h>
+
+#include <algorithm>
+
+namespace huestream {
+
+    ConnectBackoff::ConnectBackoff(int64_t minDelay, int64_t maxDelay) :
+            _minDelay(std::max<int64_t>(minDelay, 0)),
+            _maxDelay(std::max(maxDelay, _minDelay)),
+            _startDelay(_minDelay),
+            _delay(_minDelay),
+            _attempts(0) {
+    }
+
+    void ConnectBackoff::Start() {
+        _delay = _startDelay;
+        _attempts = 0;
+    }
+
+    int64_t ConnectBackoff::GetNextDelay() {
+        if (_attempts > 0) {
+            _delay = std::min(std::max<int64_t>(_delay * 2, 1), _maxDelay);
+        }
+        _attempts++;
+        return _delay;
+    }
+
+    void ConnectBackoff::Succeeded() {
+        if (_attempts == 0) {
+            return;
+        }
+        _startDelay = _attempts == 1 ? std::max(_delay / 2, _minDelay) : _delay;
+    }
+
+    int64_t ConnectBackoff::GetStartDelay() const {
+        return _startDelay;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_STREAM_CONNECTBACKOFF_H_
+#define HUESTREAM_STREAM_CONNECTBACKOFF_H_
+
+#include <stdint.h>
+
+namespace huestream {
+
+    /**
+     delays before the attempts to connect to the streaming port of a bridge
+     @note the delay doubles after every failed attempt, a new sequence of attempts starts with the delay which
+     succeeded in the previous sequence, or half of it when that was the first attempt so the delay can shrink again
+     */
+    class ConnectBackoff {
+    public:
+        /**
+         constructor
+         @param minDelay Shortest delay in milliseconds
+         @param maxDelay Longest delay in milliseconds
+         */
+        explicit ConnectBackoff(int64_t minDelay = 50, int64_t maxDelay = 1000);
+
+        /**
+         start a new sequence of attempts
+         */
+        void Start();
+
+        /**
+         get the delay in milliseconds before the next attempt
+         */
+        int64_t GetNextDelay();
+
+        /**
+         register that the last attempt succeeded, which adapts the delay the next sequence starts with
+         */
+        void Succeeded();
+
+        /**
+         get the delay in milliseconds the next sequence starts with
+         */
+        int64_t GetStartDelay() const;
+
+    protected:
+        int64_t _minDelay;
+        int64_t _maxDelay;
+        int64_t _startDelay;
+        int64_t _delay;
+        int _attempts;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_STREAM_CONNECTBACKOFF_H_
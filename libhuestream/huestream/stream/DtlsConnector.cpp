@@ -53,8 +53,24 @@ std::vector<unsigned char> HexToBytes(const std::string &hex) {
 
 bool DtlsConnector::Connect(BridgePtr bridge, unsigned short port) {
     auto strPort = std::to_string(port);
-    auto pskInfo = PSKInfo(bridge->IsSupportingClipV2() ? bridge->GetAppId().c_str() : bridge->GetUser().c_str(), HexToBytes(bridge->GetClientKey()));
-    return client_->connect(bridge->GetIpAddress().c_str(), strPort.c_str(), pskInfo);
+    auto identity = bridge->IsSupportingClipV2() ? bridge->GetAppId() : bridge->GetUser();
+    auto pskInfo = PSKInfo(identity.c_str(), HexToBytes(bridge->GetClientKey()));
+
+    auto sessionKey = bridge->GetId() + "/" + bridge->GetIpAddress() + "/" + identity + "/" + bridge->GetClientKey();
+    auto session = sessions_.find(sessionKey);
+    auto connected = client_->connect(bridge->GetIpAddress().c_str(), strPort.c_str(), pskInfo,
+                                      session != sessions_.end() ? session->second : std::vector<unsigned char>());
+    if (!connected) {
+        // don't offer the session again, in case it is what made the handshake fail
+        sessions_.erase(sessionKey);
+        return false;
+    }
+
+    std::vector<unsigned char> newSession;
+    if (client_->get_session(&newSession)) {
+        sessions_[sessionKey] = newSession;
+    }
+    return true;
 }
 
 void DtlsConnector::Disconnect() {
@@ -62,13 +78,25 @@ void DtlsConnector::Disconnect() {
 }
 
 bool DtlsConnector::Send(const char *buffer, unsigned int bufferSize) {
-    client_->send(const_cast<char *>(buffer), bufferSize);
-    // todo: check return value
+    return client_->send(buffer, bufferSize) == bufferSize;
+}
+
+bool DtlsConnector::SetAsyncSend(bool enabled) {
+    client_->set_async_send(enabled);
     return true;
 }
 
+void DtlsConnector::SetSocketOptions(const SocketOptions &options) {
+    *socketOptions_ = options;
+}
+
+int64_t DtlsConnector::GetDroppedFrameCount() const {
+    return static_cast<int64_t>(client_->get_send_statistics().dropped);
+}
+
 DtlsConnector::DtlsConnector(EntropyProviderBasePtr entropyProvider, LogFunction logFunction) {
     entropyProvider_ = entropyProvider;
+    socketOptions_ = std::make_shared<SocketOptions>();
     wrapper_ = MbedtlsClientWrapperFactory::get(CreatePlatform(logFunction));
     client_ = std::make_shared<DTLSClient>(wrapper_, this);
 }
@@ -82,7 +110,7 @@ MbedtlsClientPlatformPtr DtlsConnector::CreatePlatform(LogFunction logFunction)
         logFunction != nullptr ? logFunction : DefaultPrintfLogger,
         entropyProvider_,
         std::make_shared<DtlsTimerProvider>(),
-        std::make_shared<DtlsUdpClient>());
+        std::make_shared<DtlsUdpClient>(socketOptions_));
 }
 EntropyProviderBasePtr DtlsConnector::GetEntropyProvider() const {
     return entropyProvider_;
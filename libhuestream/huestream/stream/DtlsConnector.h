@@ -14,7 +14,10 @@
 #include "edtls/wrapper/IClientWrapper.h"
 #include "edtls/wrapper/mbedtls/MbedtlsClientPlatform.h"
 
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 typedef void (*LogFunction)(const char *text);
 
@@ -25,12 +28,19 @@ namespace huestream {
         std::shared_ptr<DTLSClient> client_;
         std::shared_ptr<IClientWrapper> wrapper_;
         EntropyProviderBasePtr entropyProvider_;
+        std::map<std::string, std::vector<unsigned char>> sessions_;
+        std::shared_ptr<SocketOptions> socketOptions_;
 
         void handshakeFailed() override;
 
         void peer_closed() override;
 
     public:
+        /**
+         constructor
+         @note the session of the last connection to each bridge is kept in memory, a reconnect to the same bridge
+         offers it for an abbreviated handshake which the bridge answers with a full handshake if it does not resume it
+         */
         explicit DtlsConnector(EntropyProviderBasePtr entropyProvider, LogFunction logFunction = nullptr);
 
         virtual ~DtlsConnector();
@@ -41,6 +51,12 @@ namespace huestream {
 
         bool Send(const char *buffer, unsigned int bufferSize) override;
 
+        bool SetAsyncSend(bool enabled) override;
+
+        void SetSocketOptions(const SocketOptions &options) override;
+
+        int64_t GetDroppedFrameCount() const override;
+
         MbedtlsClientPlatformPtr CreatePlatform(LogFunction logFunction) const;
 
         EntropyProviderBasePtr GetEntropyProvider() const;
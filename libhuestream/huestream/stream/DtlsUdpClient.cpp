@@ -27,6 +27,9 @@ netstatus_e DtlsUdpClient::Connect(const std::string& host, unsigned int port) {
     remote_.set_ip(host);
     remote_.set_port(port);
     connected = true;
+    if (socketOptions_ != nullptr) {
+        ApplySocketOptions(*socketOptions_, socketUdp_);
+    }
     if (socketUdp_->bind() != support::SOCKET_STATUS_OK)
         return MBEDTLS_ERR_NET_BIND_FAILED;
     if (socketUdp_->connect_sync(remote_) != support::SOCKET_STATUS_OK)
@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "support/network/sockets/SocketUdp.h"
+#include "huestream/stream/SocketOptions.h"
 #include "edtls/wrapper/mbedtls/UDPBase.h"
 #include "edtls/wrapper/mbedtls/UDPClientBase.h"
 
@@ -20,11 +21,17 @@ class DtlsUdpClient : public UDPBlocking<UDPClientBase> {
     std::shared_ptr<support::SocketUdp> socketUdp_;
     support::SocketAddress remote_;
     bool connected;
+    std::shared_ptr<const SocketOptions> socketOptions_;
 
     int Send(const unsigned char *buf, size_t len) override;
 
  public:
-    DtlsUdpClient() : socketUdp_(nullptr), remote_("", 0), connected(false) {}
+    /**
+     constructor
+     @param socketOptions Options applied to the socket on every connect, shared with the connector so it can change them
+     */
+    explicit DtlsUdpClient(std::shared_ptr<const SocketOptions> socketOptions = nullptr)
+        : socketUdp_(nullptr), remote_("", 0), connected(false), socketOptions_(socketOptions) {}
 
     netstatus_e Connect(const std::string& host, unsigned int port) override;
 
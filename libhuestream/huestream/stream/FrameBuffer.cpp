@@ -0,0 +1,47 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/FrameBuffer.h>
+
+#include <vector>
+
+namespace huestream {
+
+    FrameBuffer::FrameBuffer() :
+            _writeIndex(0),
+            _readIndex(1),
+            _middleIndex(2),
+            _droppedFrameCount(0) {
+    }
+
+    std::vector<uint8_t>& FrameBuffer::GetWriteFrame() {
+        return _frames[_writeIndex];
+    }
+
+    void FrameBuffer::Publish() {
+        auto previous = _middleIndex.exchange(_writeIndex | NewFrameFlag, std::memory_order_acq_rel);
+        if (previous & NewFrameFlag) {
+            _droppedFrameCount++;
+        }
+        _writeIndex = previous & IndexMask;
+    }
+
+    bool FrameBuffer::Consume() {
+        if (!(_middleIndex.load(std::memory_order_relaxed) & NewFrameFlag)) {
+            return false;
+        }
+        _readIndex = _middleIndex.exchange(_readIndex, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    const std::vector<uint8_t>& FrameBuffer::GetReadFrame() const {
+        return _frames[_readIndex];
+    }
+
+    int64_t FrameBuffer::GetDroppedFrameCount() const {
+        return _droppedFrameCount;
+    }
+
+}  // namespace huestream
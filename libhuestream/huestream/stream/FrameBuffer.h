@@ -0,0 +1,64 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_STREAM_FRAMEBUFFER_H_
+#define HUESTREAM_STREAM_FRAMEBUFFER_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     lock-free triple buffer handing serialized frames from a single producer to a single consumer
+     @note the producer never waits for the consumer, a frame which is not consumed before the next one is
+     published is dropped, so the consumer always gets the latest frame
+     */
+    class FrameBuffer {
+    public:
+        FrameBuffer();
+
+        /**
+         get the slot the producer writes the next frame into
+         */
+        std::vector<uint8_t>& GetWriteFrame();
+
+        /**
+         make the write slot available to the consumer and start a new write slot
+         */
+        void Publish();
+
+        /**
+         take the latest published frame if there is one that was not consumed yet
+         @return true if a new frame is available in the read slot
+         */
+        bool Consume();
+
+        /**
+         get the slot containing the last consumed frame
+         */
+        const std::vector<uint8_t>& GetReadFrame() const;
+
+        /**
+         get the number of published frames which were overwritten before being consumed
+         */
+        int64_t GetDroppedFrameCount() const;
+
+    protected:
+        static const int IndexMask = 0x3;
+        static const int NewFrameFlag = 0x4;
+
+        std::vector<uint8_t> _frames[3];
+        int _writeIndex;
+        int _readIndex;
+        std::atomic<int> _middleIndex;
+        std::atomic<int64_t> _droppedFrameCount;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_STREAM_FRAMEBUFFER_H_
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/FramePacer.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace huestream {
+
+    FramePacer::FramePacer() :
+            _scheduleLock(),
+            _period(std::chrono::milliseconds(20)),
+            _spinTime(0),
+            _frameTimesIndex(0),
+            _frameCount(0),
+            _lateFrameCount(0) {
+        _frameTimes.reserve(StatisticsWindow);
+    }
+
+    void FramePacer::Start(int frequency, std::chrono::microseconds spinTime) {
+        {
+            std::lock_guard<std::mutex> lock(_scheduleLock);
+            _period = std::chrono::nanoseconds(std::chrono::seconds(1)) / std::max(frequency, 1);
+            _spinTime = std::min<std::chrono::nanoseconds>(spinTime, _period);
+            _nextDeadline = Clock::now() + _period;
+        }
+
+        std::lock_guard<std::mutex> lock(_statisticsLock);
+        _lastFrame = Clock::time_point();
+        _frameTimes.clear();
+        _frameTimesIndex = 0;
+        _frameCount = 0;
+        _lateFrameCount = 0;
+    }
+
+    void FramePacer::WaitForNextFrame() {
+        auto now = Clock::now();
+        Clock::time_point deadline;
+        std::chrono::nanoseconds spinTime;
+        {
+            // claim the deadline before waiting, so a restart during the wait is not overwritten afterwards
+            std::lock_guard<std::mutex> lock(_scheduleLock);
+            if (now - _nextDeadline > _period) {
+                _nextDeadline = now;
+            }
+            deadline = _nextDeadline;
+            spinTime = _spinTime;
+            _nextDeadline += _period;
+        }
+
+        if (deadline - now > spinTime) {
+            std::this_thread::sleep_until(deadline - spinTime);
+        }
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    void FramePacer::MarkFrame() {
+        MarkFrame(Clock::now());
+    }
+
+    void FramePacer::MarkFrame(Clock::time_point now) {
+        auto period = GetPeriod();
+        std::lock_guard<std::mutex> lock(_statisticsLock);
+
+        if (_lastFrame != Clock::time_point()) {
+            auto frameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _lastFrame);
+            if (frameTime > period + period / 2) {
+                _lateFrameCount++;
+            }
+
+            if (_frameTimes.size() < StatisticsWindow) {
+                _frameTimes.push_back(frameTime.count());
+            } else {
+                _frameTimes[_frameTimesIndex] = frameTime.count();
+            }
+            _frameTimesIndex = (_frameTimesIndex + 1) % StatisticsWindow;
+        }
+
+        _lastFrame = now;
+        _frameCount++;
+    }
+
+    FrameStatistics FramePacer::GetStatistics() const {
+        std::vector<int64_t> frameTimes;
+        FrameStatistics statistics;
+        {
+            std::lock_guard<std::mutex> lock(_statisticsLock);
+            frameTimes = _frameTimes;
+            statistics.frameCount = _frameCount;
+            statistics.lateFrameCount = _lateFrameCount;
+            statistics.droppedFrameCount = 0;
+            statistics.suppressedFrameCount = 0;
+            statistics.sendCount = 0;
+            statistics.sendFailureCount = 0;
+        }
+
+        statistics.meanFrameTimeMs = 0;
+        statistics.p99FrameTimeMs = 0;
+        statistics.meanSendTimeMs = 0;
+        statistics.maxSendTimeMs = 0;
+        statistics.connectAttemptCount = 0;
+        statistics.connectTimeMs = 0;
+        if (frameTimes.empty()) {
+            return statistics;
+        }
+
+        double sum = 0;
+        for (auto frameTime : frameTimes) {
+            sum += frameTime;
+        }
+        statistics.meanFrameTimeMs = sum / frameTimes.size() / 1e6;
+
+        auto p99 = frameTimes.begin() + (frameTimes.size() * 99) / 100;
+        std::nth_element(frameTimes.begin(), p99, frameTimes.end());
+        statistics.p99FrameTimeMs = *p99 / 1e6;
+
+        return statistics;
+    }
+
+    std::chrono::nanoseconds FramePacer::GetPeriod() const {
+        std::lock_guard<std::mutex> lock(_scheduleLock);
+        return _period;
+    }
+
+}  // namespace huestream
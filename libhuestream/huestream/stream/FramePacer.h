@@ -0,0 +1,89 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_STREAM_FRAMEPACER_H_
+#define HUESTREAM_STREAM_FRAMEPACER_H_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     statistics on the frame timing and sending of a stream
+     @note frame times are measured between the start of consecutive frames, send times cover encryption and transmission
+     @note connect time covers activating streaming on the bridge until the handshake of the current session completed
+     */
+    typedef struct {
+        int64_t frameCount;
+        int64_t lateFrameCount;
+        int64_t droppedFrameCount;
+        int64_t suppressedFrameCount;
+        int64_t sendCount;
+        int64_t sendFailureCount;
+        double meanSendTimeMs;
+        double maxSendTimeMs;
+        double meanFrameTimeMs;
+        double p99FrameTimeMs;
+        int64_t connectAttemptCount;
+        double connectTimeMs;
+    } FrameStatistics;
+
+    /**
+     schedules frames on absolute deadlines of a steady clock and keeps frame time statistics
+     @note deadlines advance by exactly one period so sleep overshoot does not accumulate, when falling behind
+     by more than a period the schedule is restarted from the current time instead of rendering a burst of frames
+     @note Start can be called from another thread than the one waiting for frames
+     */
+    class FramePacer {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        FramePacer();
+
+        /**
+         restart the frame schedule and statistics
+         @param frequency Number of frames per second
+         @param spinTime Time before each deadline which is busy waited instead of slept, for sub scheduler tick accuracy
+         */
+        void Start(int frequency, std::chrono::microseconds spinTime = std::chrono::microseconds(0));
+
+        /**
+         block until the deadline of the next frame, the first deadline is one period after Start
+         */
+        void WaitForNextFrame();
+
+        /**
+         register the start of a frame in the statistics
+         */
+        void MarkFrame();
+
+        FrameStatistics GetStatistics() const;
+
+        std::chrono::nanoseconds GetPeriod() const;
+
+    protected:
+        void MarkFrame(Clock::time_point now);
+
+        static const size_t StatisticsWindow = 512;
+
+        mutable std::mutex _scheduleLock;
+        std::chrono::nanoseconds _period;
+        std::chrono::nanoseconds _spinTime;
+        Clock::time_point _nextDeadline;
+
+        mutable std::mutex _statisticsLock;
+        Clock::time_point _lastFrame;
+        std::vector<int64_t> _frameTimes;
+        size_t _frameTimesIndex;
+        int64_t _frameCount;
+        int64_t _lateFrameCount;
+    };
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_STREAM_FRAMEPACER_H_
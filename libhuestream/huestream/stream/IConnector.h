@@ -7,6 +7,9 @@
 #define HUESTREAM_STREAM_ICONNECTOR_H_
 
 #include "huestream/common/data/Bridge.h"
+#include "huestream/stream/SocketOptions.h"
+
+#include <stdint.h>
 
 #include <string>
 #include <memory>
@@ -24,6 +27,30 @@ namespace huestream {
         virtual void Disconnect() = 0;
 
         virtual bool Send(const char *buffer, unsigned int bufferSize) = 0;
+
+        /**
+         set whether the connector encrypts and sends frames on a thread of its own, Send then only hands over the
+         frame and a frame which was not sent before the next one is dropped
+         @note takes effect on the next Connect
+         @return false if the connector does not support this, Send then always sends before returning
+         */
+        virtual bool SetAsyncSend(bool /*enabled*/) {
+            return false;
+        }
+
+        /**
+         set the options of the socket the connector streams over
+         @note takes effect on the next Connect
+         */
+        virtual void SetSocketOptions(const SocketOptions & /*options*/) {
+        }
+
+        /**
+         get the number of frames which were dropped because a newer frame was handed over before they were sent
+         */
+        virtual int64_t GetDroppedFrameCount() const {
+            return 0;
+        }
     };
 
     typedef std::shared_ptr<IConnector> ConnectorPtr;
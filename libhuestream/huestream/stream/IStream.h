@@ -8,6 +8,7 @@
 
 #include "huestream/common/data/Bridge.h"
 #include "huestream/stream/IConnector.h"
+#include "huestream/stream/FramePacer.h"
 
 #include <functional>
 #include <memory>
@@ -36,6 +37,8 @@ namespace huestream {
 
         virtual int32_t GetStreamCounter() const = 0;
 
+        virtual FrameStatistics GetFrameStatistics() const = 0;
+
         virtual void UpdateBridgeGroup(BridgePtr bridge) = 0;
     };
 
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/MultiBridgeStream.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace huestream {
+
+    MultiBridgeStream::MultiBridgeStream(StreamSettingsPtr streamSettings) :
+            _streamSettings(streamSettings),
+            _group(std::make_shared<Group>()),
+            _renderThread(),
+            _running(false) {
+    }
+
+    MultiBridgeStream::~MultiBridgeStream() {
+        Stop();
+    }
+
+    StreamSettingsPtr MultiBridgeStream::CreateBridgeStreamSettings() const {
+        auto settings = std::make_shared<StreamSettings>(*_streamSettings);
+        settings->SetUseSendThread(true);
+        return settings;
+    }
+
+    void MultiBridgeStream::AddBridge(BridgePtr bridge, StreamPtr stream) {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        // rendering is done once for all bridges by this stream
+        stream->SetRenderCallback(StreamRenderCallback());
+        _bridgeStreams.push_back({bridge, stream});
+
+        if (bridge->IsValidGroupSelected()) {
+            for (const auto& light : *bridge->GetGroup()->GetLights()) {
+                _group->GetLights()->push_back(light);
+            }
+        }
+    }
+
+    GroupPtr MultiBridgeStream::GetGroup() const {
+        return _group;
+    }
+
+    void MultiBridgeStream::SetRenderCallback(StreamRenderCallback callback) {
+        std::lock_guard<std::mutex> lock(_lock);
+        _renderCallback = callback;
+    }
+
+    bool MultiBridgeStream::Start() {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        if (_running) {
+            return true;
+        }
+
+        // each bridge has its own handshake, so connect them at the same time instead of one after the other
+        std::vector<std::future<bool>> starts;
+        for (const auto& bridgeStream : _bridgeStreams) {
+            starts.push_back(std::async(std::launch::async, [bridgeStream]() {
+                return bridgeStream.stream->Start(bridgeStream.bridge);
+            }));
+        }
+
+        std::vector<bool> started;
+        for (auto& start : starts) {
+            started.push_back(start.get());
+        }
+
+        if (std::find(started.begin(), started.end(), false) != started.end()) {
+            for (size_t i = 0; i < _bridgeStreams.size(); ++i) {
+                if (started[i]) {
+                    _bridgeStreams[i].stream->Stop();
+                }
+            }
+            return false;
+        }
+
+        _framePacer.Start(_streamSettings->GetUpdateFrequency(),
+                          std::chrono::microseconds(_streamSettings->GetFramePacingSpinMicroseconds()));
+        _running = true;
+        return true;
+    }
+
+    bool MultiBridgeStream::StartWithRenderThread() {
+        if (_running) {
+            return true;
+        }
+
+        if (!Start()) {
+            return false;
+        }
+        _renderThread = std::make_shared<std::thread>(&MultiBridgeStream::RenderThread, this);
+
+        return true;
+    }
+
+    void MultiBridgeStream::Stop() {
+        if (!_running) {
+            return;
+        }
+
+        _running = false;
+
+        if (_renderThread != nullptr) {
+            _renderThread->join();
+            _renderThread.reset();
+        }
+
+        std::lock_guard<std::mutex> lock(_lock);
+        for (const auto& bridgeStream : _bridgeStreams) {
+            bridgeStream.stream->Stop();
+        }
+    }
+
+    bool MultiBridgeStream::IsStreaming() const {
+        return _running;
+    }
+
+    void MultiBridgeStream::RenderThread() {
+        while (_running) {
+            RenderSingleFrame();
+            _framePacer.WaitForNextFrame();
+        }
+    }
+
+    void MultiBridgeStream::RenderSingleFrame() {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        if (!_running)
+            return;
+
+        _framePacer.MarkFrame();
+
+        if (_renderCallback)
+            _renderCallback();
+
+        for (const auto& bridgeStream : _bridgeStreams) {
+            bridgeStream.stream->RenderSingleFrame();
+        }
+    }
+
+    std::vector<BridgeStreamStatistics> MultiBridgeStream::GetStatistics() const {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        std::vector<BridgeStreamStatistics> statistics;
+        for (const auto& bridgeStream : _bridgeStreams) {
+            statistics.push_back({bridgeStream.bridge->GetId(),
+                                  bridgeStream.stream->IsStreaming(),
+                                  bridgeStream.stream->GetFrameStatistics()});
+        }
+        return statistics;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_STREAM_MULTIBRIDGESTREAM_H_
+#define HUESTREAM_STREAM_MULTIBRIDGESTREAM_H_
+
+#include "huestream/common/data/Bridge.h"
+#include "huestream/common/data/Group.h"
+#include "huestream/stream/FramePacer.h"
+#include "huestream/stream/IStream.h"
+#include "huestream/stream/StreamSettings.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace huestream {
+
+    /**
+     health and timing of the stream to one bridge
+     */
+    typedef struct {
+        std::string bridgeId;
+        bool isStreaming;
+        FrameStatistics frameStatistics;
+    } BridgeStreamStatistics;
+
+    /**
+     streams one render loop to multiple bridges in lock-step
+     @note every tick the render callback is called once, after which the resulting light colors are encoded and sent
+     to every bridge over its own stream, connector and DTLS session
+     @note create the bridge streams with CreateBridgeStreamSettings() so every bridge encrypts and sends on its own
+     thread and a slow bridge does not delay the others
+     @note not used by huestream::HueStream, which connects to a single bridge
+     */
+    class MultiBridgeStream {
+    public:
+        explicit MultiBridgeStream(StreamSettingsPtr streamSettings);
+
+        virtual ~MultiBridgeStream();
+
+        /**
+         create settings for the stream to one of the bridges
+         @return copy of the settings of this stream with the send thread enabled
+         */
+        StreamSettingsPtr CreateBridgeStreamSettings() const;
+
+        /**
+         add a bridge to stream to
+         @param bridge Bridge with the entertainment group to stream to selected
+         @param stream Stream with its own connector, should not be started yet
+         */
+        void AddBridge(BridgePtr bridge, StreamPtr stream);
+
+        /**
+         get a group containing the lights of all bridges, to be rendered on by the render callback
+         @note the lights are shared with the groups of the bridges, positions are used as is
+         */
+        GroupPtr GetGroup() const;
+
+        void SetRenderCallback(StreamRenderCallback callback);
+
+        /**
+         start streaming to all bridges
+         @note the bridges are connected concurrently
+         @return false when any of the bridges could not be started, in which case none is streaming
+         */
+        bool Start();
+
+        bool StartWithRenderThread();
+
+        void Stop();
+
+        bool IsStreaming() const;
+
+        /**
+         render one frame and send it to all bridges
+         */
+        void RenderSingleFrame();
+
+        std::vector<BridgeStreamStatistics> GetStatistics() const;
+
+    protected:
+        typedef struct {
+            BridgePtr bridge;
+            StreamPtr stream;
+        } BridgeStream;
+
+        virtual void RenderThread();
+
+        StreamSettingsPtr _streamSettings;
+        std::vector<BridgeStream> _bridgeStreams;
+        GroupPtr _group;
+        StreamRenderCallback _renderCallback;
+        std::shared_ptr<std::thread> _renderThread;
+        std::atomic<bool> _running;
+        FramePacer _framePacer;
+        mutable std::mutex _lock;
+    };
+
+    typedef std::shared_ptr<MultiBridgeStream> MultiBridgeStreamPtr;
+}  // namespace huestream
+
+#endif  // HUESTREAM_STREAM_MULTIBRIDGESTREAM_H_
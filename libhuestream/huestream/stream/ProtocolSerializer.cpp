@@ -6,6 +6,7 @@
 #include <huestream/stream/ProtocolSerializer.h>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace huestream {
@@ -15,72 +16,158 @@ namespace huestream {
 #define ADDRTYPE_LIGHTID 0x00
 #define ADDRTYPE_GROUPID 0x01
 
+#define HEADER_SIZE 16
+#define HEADER_SEQNR_OFFSET 11
+#define HEADER_COLORSPACE_OFFSET 14
+#define COLOR_SIZE 6
+
+    static inline double Clamp(double value) {
+        if (value > 1) return 1;
+        if (!(value > 0)) return 0;
+        return value;
+    }
+
+    static inline uint16_t ToUint16(double value) {
+        return static_cast<uint16_t>(Clamp(value) * 65535);
+    }
+
+    static inline bool WriteUint16(uint8_t* dest, uint16_t value) {
+        auto high = static_cast<uint8_t>((value & 0xff00) >> 8);
+        auto low = static_cast<uint8_t>(value & 0x00ff);
+        auto changed = dest[0] != high || dest[1] != low;
+        dest[0] = high;
+        dest[1] = low;
+        return changed;
+    }
+
     ProtocolSerializer::ProtocolSerializer(std::shared_ptr<StreamOptions> options)
-            : _options(options) {
+            : _options(options), _invalidated(true), _payloadChanged(false) {
     }
 
     ProtocolSerializer::~ProtocolSerializer() {
     }
 
+    void ProtocolSerializer::Invalidate() {
+        _invalidated = true;
+    }
 
-    std::vector<uint8_t> ProtocolSerializer::Serialize(uint8_t seqNr) {
-        std::vector<uint8_t> payload;
-
-        payload.push_back(static_cast<uint8_t>('H'));
-        payload.push_back(static_cast<uint8_t>('u'));
-        payload.push_back(static_cast<uint8_t>('e'));
-        payload.push_back(static_cast<uint8_t>('S'));
-        payload.push_back(static_cast<uint8_t>('t'));
-        payload.push_back(static_cast<uint8_t>('r'));
-        payload.push_back(static_cast<uint8_t>('e'));
-        payload.push_back(static_cast<uint8_t>('a'));
-        payload.push_back(static_cast<uint8_t>('m'));
-        payload.push_back(static_cast<uint8_t>(_options->useClipV2 ? 0x02 : 0x01));
-        payload.push_back(static_cast<uint8_t>(VERSION_MINOR));
-        payload.push_back(static_cast<uint8_t>(seqNr));
-        payload.push_back(static_cast<uint8_t>(RESERVED));
-        payload.push_back(static_cast<uint8_t>(RESERVED));
-        payload.push_back(static_cast<uint8_t>(_options->colorSpace));
-        payload.push_back(static_cast<uint8_t>(RESERVED));
-
-        if (_options->useClipV2) {
-            const std::string& id = _options->group->GetId();
-            for (int i = 0; i < id.size(); ++i) {
-                payload.push_back(static_cast<uint8_t>(id.at(i)));
-            }
+    bool ProtocolSerializer::IsPayloadChanged() const {
+        return _payloadChanged;
+    }
+
+    bool ProtocolSerializer::IsPrepared() const {
+        return !_invalidated &&
+               _preparedGroup == _options->group &&
+               _preparedLights == _options->group->GetLights() &&
+               _colorOffsets.size() == _preparedLights->size() &&
+               _buffer[HEADER_COLORSPACE_OFFSET] == static_cast<uint8_t>(_options->colorSpace);
+    }
+
+    void ProtocolSerializer::Prepare() {
+        _invalidated = false;
+        _preparedGroup = _options->group;
+        _preparedLights = _preparedGroup->GetLights();
+
+        const auto useClipV2 = _options->useClipV2;
+        const auto& groupId = _preparedGroup->GetId();
+        const auto channelSize = (useClipV2 ? 1 : 3) + COLOR_SIZE;
+
+        _buffer.clear();
+        _buffer.reserve(HEADER_SIZE + (useClipV2 ? groupId.size() : 0) + _preparedLights->size() * channelSize);
+        _colorOffsets.clear();
+        _colorOffsets.reserve(_preparedLights->size());
+        _channelValues.assign(_options->colorSpace == COLORSPACE_XYBRI ? 6 * _preparedLights->size() : 0, 0.0);
+
+        const char protocolName[] = "HueStream";
+        _buffer.insert(_buffer.end(), protocolName, protocolName + sizeof(protocolName) - 1);
+        _buffer.push_back(static_cast<uint8_t>(useClipV2 ? 0x02 : 0x01));
+        _buffer.push_back(static_cast<uint8_t>(VERSION_MINOR));
+        _buffer.push_back(static_cast<uint8_t>(0));
+        _buffer.push_back(static_cast<uint8_t>(RESERVED));
+        _buffer.push_back(static_cast<uint8_t>(RESERVED));
+        _buffer.push_back(static_cast<uint8_t>(_options->colorSpace));
+        _buffer.push_back(static_cast<uint8_t>(RESERVED));
+
+        if (useClipV2) {
+            _buffer.insert(_buffer.end(), groupId.begin(), groupId.end());
         }
 
-        for (auto l : *_options->group->GetLights()) {
+        for (const auto& l : *_preparedLights) {
             auto id = static_cast<uint16_t>(std::stoul(l->GetId()));
 
-            auto color = l->GetColor();
-            color.Clamp();
-            auto r = static_cast<uint16_t>(color.GetR() * 65535);
-            auto g = static_cast<uint16_t>(color.GetG() * 65535);
-            auto b = static_cast<uint16_t>(color.GetB() * 65535);
-
-            if (!_options->useClipV2) {
+            if (!useClipV2) {
                 if (id >= 100) {
-                    payload.push_back(static_cast<uint8_t>(ADDRTYPE_GROUPID));
+                    _buffer.push_back(static_cast<uint8_t>(ADDRTYPE_GROUPID));
                     id = id - 100;
+                } else {
+                    _buffer.push_back(static_cast<uint8_t>(ADDRTYPE_LIGHTID));
                 }
-                else {
-                    payload.push_back(static_cast<uint8_t>(ADDRTYPE_LIGHTID));
-                }
+                _buffer.push_back(static_cast<uint8_t>((id & 0xff00) >> 8));
             }
+            _buffer.push_back(static_cast<uint8_t>(id & 0x00ff));
 
-            if (!_options->useClipV2) {
-                payload.push_back(static_cast<uint8_t>((id & 0xff00) >> 8));
-            }
-            payload.push_back(static_cast<uint8_t>(id & 0x00ff));
-            payload.push_back(static_cast<uint8_t>((r & 0xff00) >> 8));
-            payload.push_back(static_cast<uint8_t>(r & 0x00ff));
-            payload.push_back(static_cast<uint8_t>((g & 0xff00) >> 8));
-            payload.push_back(static_cast<uint8_t>(g & 0x00ff));
-            payload.push_back(static_cast<uint8_t>((b & 0xff00) >> 8));
-            payload.push_back(static_cast<uint8_t>(b & 0x00ff));
+            _colorOffsets.push_back(_buffer.size());
+            _buffer.insert(_buffer.end(), COLOR_SIZE, 0);
+        }
+    }
+
+    const std::vector<uint8_t>& ProtocolSerializer::Serialize(uint8_t seqNr) {
+        auto prepared = IsPrepared();
+        if (!prepared) {
+            Prepare();
+        }
+
+        auto data = _buffer.data();
+        data[HEADER_SEQNR_OFFSET] = seqNr;
+
+        if (_options->colorSpace == COLORSPACE_XYBRI) {
+            _payloadChanged = WriteXYBrightness(data) || !prepared;
+        } else {
+            _payloadChanged = WriteRGB(data) || !prepared;
+        }
+
+        return _buffer;
+    }
+
+    bool ProtocolSerializer::WriteRGB(uint8_t* data) {
+        const auto& lights = *_preparedLights;
+        auto changed = false;
+        for (size_t i = 0; i < _colorOffsets.size(); ++i) {
+            const auto& color = lights[i]->GetColor();
+            auto dest = data + _colorOffsets[i];
+            changed |= WriteUint16(dest, ToUint16(color.GetR()));
+            changed |= WriteUint16(dest + 2, ToUint16(color.GetG()));
+            changed |= WriteUint16(dest + 4, ToUint16(color.GetB()));
         }
+        return changed;
+    }
+
+    bool ProtocolSerializer::WriteXYBrightness(uint8_t* data) {
+        const auto& lights = *_preparedLights;
+        const auto count = _colorOffsets.size();
+        auto r = _channelValues.data();
+        auto g = r + count;
+        auto b = g + count;
+        auto x = b + count;
+        auto y = x + count;
+        auto bri = y + count;
 
-        return payload;
+        for (size_t i = 0; i < count; ++i) {
+            const auto& color = lights[i]->GetColor();
+            r[i] = Clamp(color.GetR());
+            g[i] = Clamp(color.GetG());
+            b[i] = Clamp(color.GetB());
+        }
+
+        Color::RGBToXYBrightness(r, g, b, x, y, bri, count);
+
+        auto changed = false;
+        for (size_t i = 0; i < count; ++i) {
+            auto dest = data + _colorOffsets[i];
+            changed |= WriteUint16(dest, ToUint16(x[i]));
+            changed |= WriteUint16(dest + 2, ToUint16(y[i]));
+            changed |= WriteUint16(dest + 4, ToUint16(bri[i]));
+        }
+        return changed;
     }
 }  // namespace huestream
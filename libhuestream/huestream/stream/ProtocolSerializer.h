@@ -8,6 +8,7 @@
 
 #include "huestream/common/data/Group.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -24,17 +25,57 @@ namespace huestream {
 				bool useClipV2;
     } StreamOptions;
 
+    /**
+     encoder for streaming protocol messages
+     @note the header, group id and channel addresses are precompiled into a reused buffer, per frame only
+     the sequence number and the color payload are patched in
+     @note with COLORSPACE_XYBRI the payload per channel is x, y and brightness instead of red, green and blue
+     */
     class ProtocolSerializer {
     public:
         explicit ProtocolSerializer(std::shared_ptr<StreamOptions> options);
 
         virtual ~ProtocolSerializer();
 
-        std::vector<uint8_t> Serialize(uint8_t seqNr);
+        /**
+         serialize the current light colors of the group into a protocol message
+         @param seqNr Sequence number of this message
+         @return reference to the internal buffer, valid until the next call
+         */
+        const std::vector<uint8_t>& Serialize(uint8_t seqNr);
+
+        /**
+         mark the precompiled message layout as outdated, it is rebuilt on the next Serialize call
+         @note call when the group or other options have changed
+         */
+        void Invalidate();
+
+        /**
+         check whether the color payload of the last serialized message differs from the one before
+         @note always true for the first message after the layout has been (re)built
+         */
+        bool IsPayloadChanged() const;
 
     protected:
+        void Prepare();
+
+        bool IsPrepared() const;
+
+        bool WriteRGB(uint8_t* data);
+
+        bool WriteXYBrightness(uint8_t* data);
+
         std::shared_ptr<StreamOptions> _options;
+        std::vector<uint8_t> _buffer;
+        std::vector<size_t> _colorOffsets;
+        std::vector<double> _channelValues;
+        std::atomic<bool> _invalidated;
+        bool _payloadChanged;
+        GroupPtr _preparedGroup;
+        LightListPtr _preparedLights;
     };
+
+    typedef std::shared_ptr<ProtocolSerializer> ProtocolSerializerPtr;
 }  // namespace huestream
 
 #endif  // HUESTREAM_STREAM_PROTOCOLSERIALIZER_H_
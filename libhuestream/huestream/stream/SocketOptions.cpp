@@ -0,0 +1,40 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/SocketOptions.h>
+
+#include "support/logging/Log.h"
+
+#include <memory>
+
+namespace huestream {
+
+    static bool CheckOption(int status, const char *name, int value) {
+        if (status != support::SOCKET_STATUS_OK) {
+            HUE_LOG << HUE_STREAM << HUE_WARN << "ApplySocketOptions: could not set " << name << " to " << value << HUE_ENDL;
+            return false;
+        }
+        return true;
+    }
+
+    bool ApplySocketOptions(const SocketOptions &options, const std::shared_ptr<support::SocketUdp> &socket) {
+        auto applied = true;
+        if (options.sendBufferSize > 0) {
+            applied = CheckOption(socket->set_send_buffer_size(options.sendBufferSize), "send buffer size", options.sendBufferSize) && applied;
+        }
+        if (options.dscp > 0) {
+            // the dscp is in the upper six bits of the type of service byte, the lower two are used for congestion
+            applied = CheckOption(socket->set_type_of_service((options.dscp & 0x3F) << 2), "dscp", options.dscp) && applied;
+        }
+        if (options.priority > 0) {
+            applied = CheckOption(socket->set_priority(options.priority), "priority", options.priority) && applied;
+        }
+        if (options.busyPollMicroseconds > 0) {
+            applied = CheckOption(socket->set_busy_poll(options.busyPollMicroseconds), "busy poll", options.busyPollMicroseconds) && applied;
+        }
+        return applied;
+    }
+
+}  // namespace huestream
@@ -0,0 +1,36 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#ifndef HUESTREAM_STREAM_SOCKETOPTIONS_H_
+#define HUESTREAM_STREAM_SOCKETOPTIONS_H_
+
+#include "support/network/sockets/SocketUdp.h"
+
+#include <memory>
+
+namespace huestream {
+
+    /**
+     options for the udp socket a connector streams over, 0 leaves the operating system default
+     */
+    struct SocketOptions {
+        SocketOptions() : sendBufferSize(0), dscp(0), priority(0), busyPollMicroseconds(0) {}
+
+        int sendBufferSize;
+        int dscp;
+        int priority;
+        int busyPollMicroseconds;
+    };
+
+    /**
+     apply socket options to a socket before it is bound
+     @note an option the platform does not support is logged and skipped, the socket can still be used
+     @return false if any option could not be set
+     */
+    bool ApplySocketOptions(const SocketOptions &options, const std::shared_ptr<support::SocketUdp> &socket);
+
+}  // namespace huestream
+
+#endif  // HUESTREAM_STREAM_SOCKETOPTIONS_H_
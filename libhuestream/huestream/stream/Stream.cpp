@@ -8,6 +8,8 @@
 #include <huestream/stream/StreamFactory.h>
 #include <huestream/config/Config.h>
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <iomanip>
 #include <sstream>
@@ -33,7 +35,15 @@ namespace huestream {
             _seqNr(0),
             _timeManager(timeManager),
             _connector(connector),
-            _streamCounter(0) {
+            _streamCounter(0),
+            _suppressedFrameCount(0),
+            _sendCount(0),
+            _sendFailureCount(0),
+            _sendTimeTotal(0),
+            _sendTimeMax(0),
+            _lastSendTime(0),
+            _connectAttemptCount(0),
+            _connectTime(0) {
     }
 
     Stream::~Stream() {
@@ -77,9 +87,29 @@ namespace huestream {
         _options = std::make_shared<StreamOptions>();
         _options->colorSpace = _streamSettings->GetStreamingColorSpace();
 				_options->useClipV2 = bridge->IsSupportingClipV2();
+        _serializer = std::make_shared<ProtocolSerializer>(_options);
         UpdateBridgeGroup(bridge);
 
-        return StartStreamingSession(bridge);
+        SocketOptions socketOptions;
+        socketOptions.sendBufferSize = _streamSettings->GetSocketSendBufferSize();
+        socketOptions.dscp = _streamSettings->GetSocketDscp();
+        socketOptions.priority = _streamSettings->GetSocketPriority();
+        socketOptions.busyPollMicroseconds = _streamSettings->GetSocketBusyPollMicroseconds();
+        _connector->SetSocketOptions(socketOptions);
+
+        // a connector which sends on a thread of its own takes the place of the send thread
+        auto connectorSendsAsync = _connector->SetAsyncSend(_streamSettings->UseSendThread());
+
+        if (!StartStreamingSession(bridge)) {
+            return false;
+        }
+
+        if (_streamSettings->UseSendThread() && !connectorSendsAsync) {
+            // discard a frame left over from a previous session
+            _frameBuffer.Consume();
+            _sendThread = make_shared<thread>(&Stream::SendThread, this);
+        }
+        return true;
     }
 
     bool Stream::IsStreamingToBridgeAndGroup(BridgePtr bridge) const {
@@ -96,6 +126,8 @@ namespace huestream {
     }
 
     bool Stream::StartStreamingSession(BridgePtr bridge) {
+        auto connectStart = std::chrono::steady_clock::now();
+
         // ready to start the stream session
         auto startSuccessful = _factory->CreateStreamStarter(bridge)->StartStream(_appSettings->GetActivationOverride());
         if (!startSuccessful) {
@@ -105,11 +137,13 @@ namespace huestream {
 
         auto connectSuccessful = false;
         auto connectAttemps = 0;
+        _connectBackoff.Start();
         while (!connectSuccessful && connectAttemps < 5) {
             // now we can connect to the streaming port
 
             // TODO(user): This is a temporary workaround until this is fixed in the bridge
-            _timeManager->Sleep(500);
+            // the bridge needs some time after activation before it accepts the handshake
+            _timeManager->Sleep(_connectBackoff.GetNextDelay());
             _running = true;
 
             connectSuccessful = _connector->Connect(bridge, (uint16_t) _streamSettings->GetStreamingPort());
@@ -119,9 +153,20 @@ namespace huestream {
             Stop();
             return false;
         }
+        _connectBackoff.Succeeded();
+        _connectAttemptCount = connectAttemps;
+        _connectTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - connectStart).count();
 
         _seqNr = 0;
         _streamCounter = 0;
+        _suppressedFrameCount = 0;
+        _sendCount = 0;
+        _sendFailureCount = 0;
+        _sendTimeTotal = 0;
+        _sendTimeMax = 0;
+        _framePacer.Start(_streamSettings->GetUpdateFrequency(),
+                          std::chrono::microseconds(_streamSettings->GetFramePacingSpinMicroseconds()));
         _timeManager->UpdateTime();
         return true;
     }
@@ -129,6 +174,7 @@ namespace huestream {
     void Stream::UpdateBridgeGroup(BridgePtr bridge) {
         if (_options != nullptr && bridge->IsValidGroupSelected()) {
             _options->group = bridge->GetGroup();
+            _serializer->Invalidate();
         }
     }
 
@@ -167,6 +213,11 @@ namespace huestream {
             _renderThread.reset();
         }
 
+        if (_sendThread != nullptr) {
+            _sendThread->join();
+            _sendThread.reset();
+        }
+
         _connector->Disconnect();
 
         if (!IsSameBridgeAndGroup(bridge)) {
@@ -182,6 +233,14 @@ namespace huestream {
     }
 
     void Stream::RenderThread() {
+        if (_streamSettings->UsePreciseFramePacing()) {
+            while (_running) {
+                RenderSingleFrame();
+                _framePacer.WaitForNextFrame();
+            }
+            return;
+        }
+
         auto sendPeriod(
                 (int64_t) ((1.0 / _streamSettings->GetUpdateFrequency()) * 1000));
 
@@ -198,6 +257,18 @@ namespace huestream {
         }
     }
 
+    void Stream::SendThread() {
+        _sendPacer.Start(_streamSettings->GetUpdateFrequency(),
+                         std::chrono::microseconds(_streamSettings->GetFramePacingSpinMicroseconds()));
+
+        while (_running) {
+            if (_frameBuffer.Consume()) {
+                SendFrame(_frameBuffer.GetReadFrame());
+            }
+            _sendPacer.WaitForNextFrame();
+        }
+    }
+
     void Stream::RenderSingleFrame() {
         std::lock_guard<std::mutex> lock(_lock);
 
@@ -205,19 +276,70 @@ namespace huestream {
             return;
 
         _streamCounter++;
+        _framePacer.MarkFrame();
         _timeManager->UpdateTime();
 
         if (_renderCallback)
             _renderCallback();
 
-        auto payload = ProtocolSerializer(_options).Serialize(_seqNr++);
-        _connector->Send(reinterpret_cast<const char *>(payload.data()), payload.size());
+        const auto& payload = _serializer->Serialize(_seqNr);
+        if (IsFrameSuppressed()) {
+            _suppressedFrameCount++;
+            return;
+        }
+        _seqNr++;
+        _lastSendTime = _timeManager->Now();
+
+        if (_sendThread != nullptr) {
+            _frameBuffer.GetWriteFrame().assign(payload.begin(), payload.end());
+            _frameBuffer.Publish();
+            return;
+        }
+        SendFrame(payload);
+    }
+
+    void Stream::SendFrame(const std::vector<uint8_t>& frame) {
+        auto sendStart = std::chrono::steady_clock::now();
+        auto success = _connector->Send(reinterpret_cast<const char *>(frame.data()), frame.size());
+        auto sendTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - sendStart).count();
+
+        _sendCount++;
+        if (!success) {
+            _sendFailureCount++;
+        }
+        _sendTimeTotal += sendTime;
+        if (sendTime > _sendTimeMax) {
+            _sendTimeMax = sendTime;
+        }
+    }
+
+    bool Stream::IsFrameSuppressed() const {
+        if (!_streamSettings->SuppressUnchangedFrames() || _serializer->IsPayloadChanged()) {
+            return false;
+        }
+
+        auto keepAlivePeriod = 1000 / std::max(_streamSettings->GetKeepAliveFrequency(), 1);
+        return _timeManager->Now() - _lastSendTime < keepAlivePeriod;
     }
 
     int32_t Stream::GetStreamCounter() const {
         return _streamCounter;
     }
 
+    FrameStatistics Stream::GetFrameStatistics() const {
+        auto statistics = _framePacer.GetStatistics();
+        statistics.droppedFrameCount = _frameBuffer.GetDroppedFrameCount() + _connector->GetDroppedFrameCount();
+        statistics.suppressedFrameCount = _suppressedFrameCount;
+        statistics.sendCount = _sendCount;
+        statistics.sendFailureCount = _sendFailureCount;
+        statistics.meanSendTimeMs = statistics.sendCount > 0 ? _sendTimeTotal / 1e6 / statistics.sendCount : 0;
+        statistics.maxSendTimeMs = _sendTimeMax / 1e6;
+        statistics.connectAttemptCount = _connectAttemptCount;
+        statistics.connectTimeMs = _connectTime / 1e6;
+        return statistics;
+    }
+
     int64_t Stream::UpdateAndGetCurrentTime() const {
         _timeManager->UpdateTime();
         return _timeManager->Now();
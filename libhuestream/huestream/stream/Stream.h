@@ -9,6 +9,8 @@
 #include "huestream/common/data/Bridge.h"
 #include "huestream/common/time/ITimeManager.h"
 #include "huestream/config/AppSettings.h"
+#include "huestream/stream/ConnectBackoff.h"
+#include "huestream/stream/FrameBuffer.h"
 #include "huestream/stream/ProtocolSerializer.h"
 #include "huestream/stream/IStream.h"
 #include "huestream/stream/IStreamStarter.h"
@@ -17,6 +19,7 @@
 
 #include <thread>
 #include <memory>
+#include <vector>
 #include <atomic>
 #include <mutex>
 
@@ -45,29 +48,52 @@ namespace huestream {
         void RenderSingleFrame() override;
 
         int32_t GetStreamCounter() const override;
+
+        FrameStatistics GetFrameStatistics() const override;
+
         void UpdateBridgeGroup(BridgePtr bridge) override;
 
      protected:
         virtual void RenderThread();
 
+        virtual void SendThread();
+
         int64_t UpdateAndGetCurrentTime() const;
 
         bool IsStreamingToBridgeAndGroup(BridgePtr bridge) const;
 
+        bool IsFrameSuppressed() const;
+
+        void SendFrame(const std::vector<uint8_t>& frame);
+
         StreamSettingsPtr _streamSettings;
         AppSettingsPtr _appSettings;
         BridgePtr _activeBridgeCopy;
         StreamRenderCallback _renderCallback;
         std::shared_ptr<IStreamFactory> _factory;
         std::shared_ptr<std::thread> _renderThread;
+        std::shared_ptr<std::thread> _sendThread;
         std::atomic<bool> _running;
         std::atomic<uint8_t> _seqNr;
         std::shared_ptr<ITimeManager> _timeManager;
         std::shared_ptr<StreamOptions> _options;
+        ProtocolSerializerPtr _serializer;
         ConnectorPtr _connector;
         std::mutex _lock;
 
         std::atomic<int32_t> _streamCounter;
+        std::atomic<int64_t> _suppressedFrameCount;
+        std::atomic<int64_t> _sendCount;
+        std::atomic<int64_t> _sendFailureCount;
+        std::atomic<int64_t> _sendTimeTotal;
+        std::atomic<int64_t> _sendTimeMax;
+        int64_t _lastSendTime;
+        std::atomic<int64_t> _connectAttemptCount;
+        std::atomic<int64_t> _connectTime;
+        ConnectBackoff _connectBackoff;
+        FramePacer _framePacer;
+        FramePacer _sendPacer;
+        FrameBuffer _frameBuffer;
         bool IsSameBridgeAndGroup(BridgePtr bridge) const;
         bool StartStreamingSession(BridgePtr bridge);
     };
@@ -10,10 +10,28 @@ namespace huestream {
     PROP_IMPL(StreamSettings, int, updateFrequency, UpdateFrequency);
     PROP_IMPL(StreamSettings, ColorSpace, streamingColorSpace, StreamingColorSpace);
     PROP_IMPL(StreamSettings, int, streamingPort, StreamingPort);
+    PROP_IMPL_BOOL(StreamSettings, bool, usePreciseFramePacing, UsePreciseFramePacing);
+    PROP_IMPL(StreamSettings, int, framePacingSpinMicroseconds, FramePacingSpinMicroseconds);
+    PROP_IMPL_BOOL(StreamSettings, bool, useSendThread, UseSendThread);
+    PROP_IMPL_BOOL(StreamSettings, bool, suppressUnchangedFrames, SuppressUnchangedFrames);
+    PROP_IMPL(StreamSettings, int, keepAliveFrequency, KeepAliveFrequency);
+    PROP_IMPL(StreamSettings, int, socketSendBufferSize, SocketSendBufferSize);
+    PROP_IMPL(StreamSettings, int, socketDscp, SocketDscp);
+    PROP_IMPL(StreamSettings, int, socketPriority, SocketPriority);
+    PROP_IMPL(StreamSettings, int, socketBusyPollMicroseconds, SocketBusyPollMicroseconds);
 
     StreamSettings::StreamSettings() {
         SetUpdateFrequency(50);
         SetStreamingColorSpace(COLORSPACE_RGB);
         SetStreamingPort(2100);
+        SetUsePreciseFramePacing(false);
+        SetFramePacingSpinMicroseconds(0);
+        SetUseSendThread(false);
+        SetSuppressUnchangedFrames(false);
+        SetKeepAliveFrequency(5);
+        SetSocketSendBufferSize(0);
+        SetSocketDscp(0);
+        SetSocketPriority(0);
+        SetSocketBusyPollMicroseconds(0);
     }
 }  // namespace huestream
@@ -20,6 +20,66 @@ namespace huestream {
     PROP_DEFINE(StreamSettings, int, updateFrequency, UpdateFrequency);
     PROP_DEFINE(StreamSettings, ColorSpace, streamingColorSpace, StreamingColorSpace);
     PROP_DEFINE(StreamSettings, int, streamingPort, StreamingPort);
+
+    /**
+     set whether the render thread schedules frames on absolute deadlines with nanosecond resolution
+     @note default false, which sleeps a whole number of milliseconds after each frame
+     */
+    PROP_DEFINE_BOOL(StreamSettings, bool, usePreciseFramePacing, UsePreciseFramePacing);
+
+    /**
+     set the time before each frame deadline which is busy waited instead of slept when precise frame pacing is used
+     @note default 0, a few hundred microseconds compensates for coarse operating system timers at the cost of cpu time
+     */
+    PROP_DEFINE(StreamSettings, int, framePacingSpinMicroseconds, FramePacingSpinMicroseconds);
+
+    /**
+     set whether frames are encrypted and sent by a separate thread
+     @note default false, when enabled the render thread only renders and hands over the latest frame, a slow send
+     no longer delays rendering and frames which could not be sent in time are dropped instead of queued
+     @note a connector which can send on a thread of its own, like the dtls connector, is used instead of a separate
+     send thread of the stream, send times then only cover handing over the frame
+     */
+    PROP_DEFINE_BOOL(StreamSettings, bool, useSendThread, UseSendThread);
+
+    /**
+     set whether frames with the same light colors as the previously sent frame are skipped
+     @note default false, unchanged frames are still sent at the keep alive frequency so the session stays alive,
+     any change is sent immediately
+     */
+    PROP_DEFINE_BOOL(StreamSettings, bool, suppressUnchangedFrames, SuppressUnchangedFrames);
+
+    /**
+     set the number of frames per second sent while the light colors are unchanged
+     @note default 5, only used when unchanged frames are suppressed
+     */
+    PROP_DEFINE(StreamSettings, int, keepAliveFrequency, KeepAliveFrequency);
+
+    /**
+     set the size in bytes of the send buffer of the streaming socket (SO_SNDBUF)
+     @note default 0, which keeps the operating system default
+     */
+    PROP_DEFINE(StreamSettings, int, socketSendBufferSize, SocketSendBufferSize);
+
+    /**
+     set the differentiated services code point of streamed packets (IP_TOS)
+     @note default 0, 46 (expedited forwarding) lets routers and wifi access points which honour it queue the packets
+     as real time traffic
+     */
+    PROP_DEFINE(StreamSettings, int, socketDscp, SocketDscp);
+
+    /**
+     set the priority of streamed packets in the queues of the kernel (SO_PRIORITY)
+     @note default 0, only supported on Linux, 1 to 6 can be set without privileges
+     */
+    PROP_DEFINE(StreamSettings, int, socketPriority, SocketPriority);
+
+    /**
+     set the time in microseconds the kernel busy polls the network device when receiving from the streaming socket
+     (SO_BUSY_POLL)
+     @note default 0, only supported on Linux, trades cpu time for a faster handshake on devices which support it
+     */
+    PROP_DEFINE(StreamSettings, int, socketBusyPollMicroseconds, SocketBusyPollMicroseconds);
     };
 
     typedef std::shared_ptr<StreamSettings> StreamSettingsPtr;
@@ -13,7 +13,8 @@ namespace huestream {
     UdpConnector::UdpConnector() :
             _socketUdp(nullptr),
             _peerAddress("", 0),
-            _connectionState(ConnectionState::Disconnected) {
+            _connectionState(ConnectionState::Disconnected),
+            _socketOptions() {
     }
 
     UdpConnector::~UdpConnector() {
@@ -26,6 +27,7 @@ namespace huestream {
         }
 
         _socketUdp = std::make_shared<support::SocketUdp>(support::SocketAddress("0.0.0.0", 0));
+        ApplySocketOptions(_socketOptions, _socketUdp);
 
         _peerAddress.set_ip(RemovePortFromIp(bridge->GetIpAddress()));
         _peerAddress.set_port(port);
@@ -43,7 +45,11 @@ namespace huestream {
         if (_connectionState != ConnectionState::Connected)
             return false;
 
-        return _socketUdp->sync_send((unsigned char *) buffer, bufferSize) != support::SOCKET_STATUS_OK;
+        return _socketUdp->sync_send((unsigned char *) buffer, bufferSize) == static_cast<int64_t>(bufferSize);
+    }
+
+    void UdpConnector::SetSocketOptions(const SocketOptions &options) {
+        _socketOptions = options;
     }
 
     void UdpConnector::Disconnect() {
@@ -31,12 +31,15 @@ namespace huestream {
 
         bool Send(const char *buffer, unsigned int bufferSize) override;
 
+        void SetSocketOptions(const SocketOptions &options) override;
+
     private:
         std::string RemovePortFromIp(std::string ip) const;
 
         std::shared_ptr<support::SocketUdp> _socketUdp;
         support::SocketAddress _peerAddress;
         ConnectionState _connectionState;
+        SocketOptions _socketOptions;
     };
 }  // namespace huestream
 
@@ -144,6 +144,48 @@ namespace support {
                                          e.g. when socket is not initialized
          */
         virtual int leave_group(const SocketAddress& address_multicast);
+
+        /**
+         Set the size of the send buffer of the kernel (SO_SNDBUF)
+         @param size The size in bytes
+         @return The result code, which represents one of the following values:
+                 - SOCKET_STATUS_OK:     option set successfully
+                 - SOCKET_STATUS_FAILED: could not set the option
+                                         e.g. when socket is not initialized
+         */
+        virtual int set_send_buffer_size(int size);
+
+        /**
+         Set the type of service byte of sent packets (IP_TOS), the DSCP is in its upper six bits
+         @param type_of_service The type of service byte, e.g. 46 << 2 for DSCP expedited forwarding
+         @return The result code, which represents one of the following values:
+                 - SOCKET_STATUS_OK:     option set successfully
+                 - SOCKET_STATUS_FAILED: could not set the option
+                                         e.g. when socket is not initialized or not supported by the platform
+         */
+        virtual int set_type_of_service(int type_of_service);
+
+        /**
+         Set the priority of sent packets in the queues of the kernel (SO_PRIORITY)
+         @note only supported on Linux
+         @param priority The priority, 0 to 6 can be set without privileges
+         @return The result code, which represents one of the following values:
+                 - SOCKET_STATUS_OK:     option set successfully
+                 - SOCKET_STATUS_FAILED: could not set the option
+                                         e.g. when socket is not initialized or not supported by the platform
+         */
+        virtual int set_priority(int priority);
+
+        /**
+         Set the time to busy poll the device for received packets before sleeping (SO_BUSY_POLL)
+         @note only supported on Linux, values above net.core.busy_read require privileges
+         @param microseconds The busy poll time in microseconds
+         @return The result code, which represents one of the following values:
+                 - SOCKET_STATUS_OK:     option set successfully
+                 - SOCKET_STATUS_FAILED: could not set the option
+                                         e.g. when socket is not initialized or not supported by the platform
+         */
+        virtual int set_busy_poll(int microseconds);
                                  
     private:
         struct Impl;
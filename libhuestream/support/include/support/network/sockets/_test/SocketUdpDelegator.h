@@ -132,6 +132,26 @@ namespace support {
          @see SocketUdp.h
          */
         int leave_group(const SocketAddress& address_multicast) override;
+
+        /** 
+         @see SocketUdp.h
+         */
+        int set_send_buffer_size(int size) override;
+
+        /** 
+         @see SocketUdp.h
+         */
+        int set_type_of_service(int type_of_service) override;
+
+        /** 
+         @see SocketUdp.h
+         */
+        int set_priority(int priority) override;
+
+        /** 
+         @see SocketUdp.h
+         */
+        int set_busy_poll(int microseconds) override;
         
         
         /* delegate provider */
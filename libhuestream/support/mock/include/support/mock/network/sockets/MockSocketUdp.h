@@ -75,6 +75,14 @@ namespace support_unittests {
                 .WillByDefault(Invoke(this, &MockSocketUdp::default_join_group));
             ON_CALL(*this, leave_group(_))
                 .WillByDefault(Invoke(this, &MockSocketUdp::default_leave_group));
+            ON_CALL(*this, set_send_buffer_size(_))
+                .WillByDefault(Invoke(this, &MockSocketUdp::default_set_option));
+            ON_CALL(*this, set_type_of_service(_))
+                .WillByDefault(Invoke(this, &MockSocketUdp::default_set_option));
+            ON_CALL(*this, set_priority(_))
+                .WillByDefault(Invoke(this, &MockSocketUdp::default_set_option));
+            ON_CALL(*this, set_busy_poll(_))
+                .WillByDefault(Invoke(this, &MockSocketUdp::default_set_option));
         }
 
         /** 
@@ -151,6 +159,26 @@ namespace support_unittests {
          
          */
         MOCK_METHOD1(leave_group, int(const SocketAddress& address_multicast));
+        
+        /** 
+         
+         */
+        MOCK_METHOD1(set_send_buffer_size, int(int size));
+        
+        /** 
+         
+         */
+        MOCK_METHOD1(set_type_of_service, int(int type_of_service));
+        
+        /** 
+         
+         */
+        MOCK_METHOD1(set_priority, int(int priority));
+        
+        /** 
+         
+         */
+        MOCK_METHOD1(set_busy_poll, int(int microseconds));
 
 
         /* fake data */
@@ -273,6 +301,11 @@ namespace support_unittests {
          */
         int default_leave_group(const SocketAddress& address_multicast);
         
+        /** 
+         
+         */
+        int default_set_option(int value);
+        
         /**
         
          */
@@ -151,6 +151,10 @@ namespace support_unittests {
     int MockSocketUdp::default_leave_group(const SocketAddress& /*address_multicast*/) {
         return SOCKET_STATUS_OK;
     }
+
+    int MockSocketUdp::default_set_option(int /*value*/) {
+        return SOCKET_STATUS_OK;
+    }
     
     void MockSocketUdp::thread_send(string data, SocketAddress /*address_remote*/, SocketCallback callback) {
         // Get fake delay
@@ -95,5 +95,21 @@ namespace support {
     int SocketUdpDelegator::leave_group(const SocketAddress& address_multicast) {
         return _delegate->leave_group(address_multicast);
     }
+
+    int SocketUdpDelegator::set_send_buffer_size(int size) {
+        return _delegate->set_send_buffer_size(size);
+    }
+
+    int SocketUdpDelegator::set_type_of_service(int type_of_service) {
+        return _delegate->set_type_of_service(type_of_service);
+    }
+
+    int SocketUdpDelegator::set_priority(int priority) {
+        return _delegate->set_priority(priority);
+    }
+
+    int SocketUdpDelegator::set_busy_poll(int microseconds) {
+        return _delegate->set_busy_poll(microseconds);
+    }
     
 }  // namespace support
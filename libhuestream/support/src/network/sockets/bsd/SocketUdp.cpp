@@ -4,6 +4,9 @@
  ********************************************************************************/
 
 #include <sys/types.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
 
 #include <atomic>
 #include <condition_variable>
@@ -27,6 +30,11 @@ using support::to_string;
 #define SIZE_CAST static_cast<size_t>
 #endif
 
+#if defined(__linux__)
+// wait for a single socket without select() scanning a whole fd set and without its FD_SETSIZE limit
+#define SOCKET_USE_EPOLL
+#endif
+
 namespace support {
     struct SocketUdp::Impl {
         /** Constructor */
@@ -38,6 +46,9 @@ namespace support {
             _connected = false;
             _socket = 0;
             _socket_address_local = {};
+#ifdef SOCKET_USE_EPOLL
+            _epoll = -1;
+#endif
         }
         /** whether the socket is opened */
         atomic_bool        _opened;
@@ -62,6 +73,22 @@ namespace support {
         mutex              _socket_mutex;
         /** the local address of the socket, usually for binding */
         sockaddr_in        _socket_address_local;
+#ifdef SOCKET_USE_EPOLL
+        /** the epoll instance which waits for the socket, created on the first synchronous receive */
+        int                _epoll;
+#endif
+
+        /**
+         Set an integer socket option
+         */
+        int set_option(int level, int name, int value);
+
+        /**
+         Wait until the socket is readable
+         @param timeout Timeout in milliseconds, 0 waits without timeout
+         @return > 0 when readable, 0 on timeout, < 0 on error with errno set
+         */
+        int wait_readable(unsigned int timeout);
         /**
          Thread for sending data
          */
@@ -102,6 +129,12 @@ namespace support {
     SocketUdp::~SocketUdp() {
         // Close the socket if open
         close();
+
+#ifdef SOCKET_USE_EPOLL
+        if (_pimpl->_epoll >= 0) {
+            ::close(_pimpl->_epoll);
+        }
+#endif
     }
 
     int SocketUdp::bind() {
@@ -253,18 +286,7 @@ namespace support {
             return SOCKET_STATUS_FAILED;
         }
 
-        fd_set set;
-        // wait 100 milliseconds
-        struct timeval tv_timeout;
-
-        tv_timeout.tv_sec = timeout / 1000;
-        tv_timeout.tv_usec = (timeout % 1000) * 1000;
-
-
-        FD_ZERO(&set);
-        FD_SET(_pimpl->_socket, &set);
-
-        auto ret = SELECT(FD_SETSIZE, &set, nullptr, nullptr, timeout == 0 ? NULL : &tv_timeout);
+        auto ret = _pimpl->wait_readable(timeout);
 
         if (ret == 0) {
             HUE_LOG << HUE_NETWORK <<  HUE_DEBUG << "SocketUdp: socket timed out" << HUE_ENDL;
@@ -277,8 +299,8 @@ namespace support {
                 return SOCKET_STATUS_AGAIN;
             }
 
-            // select failed / socket invalid
-            HUE_LOG << HUE_NETWORK << HUE_DEBUG << "SocketUdp: receiving data failed , msg: " << "socket failure, select() failed with code:" + to_string(errno) << HUE_ENDL;
+            // waiting failed / socket invalid
+            HUE_LOG << HUE_NETWORK << HUE_DEBUG << "SocketUdp: receiving data failed , msg: " << "socket failure, waiting for data failed with code:" + to_string(errno) << HUE_ENDL;
             return SOCKET_STATUS_FAILED;
         }
 
@@ -407,6 +429,86 @@ namespace support {
         return status;
     }
 
+    int SocketUdp::set_send_buffer_size(int size) {
+        return _pimpl->set_option(SOL_SOCKET, SO_SNDBUF, size);
+    }
+
+    int SocketUdp::set_type_of_service(int type_of_service) {
+#if defined(IP_TOS)
+        return _pimpl->set_option(IPPROTO_IP, IP_TOS, type_of_service);
+#else
+        (void)type_of_service;
+        return SOCKET_STATUS_FAILED;
+#endif
+    }
+
+    int SocketUdp::set_priority(int priority) {
+#if defined(SO_PRIORITY)
+        return _pimpl->set_option(SOL_SOCKET, SO_PRIORITY, priority);
+#else
+        (void)priority;
+        return SOCKET_STATUS_FAILED;
+#endif
+    }
+
+    int SocketUdp::set_busy_poll(int microseconds) {
+#if defined(SO_BUSY_POLL)
+        return _pimpl->set_option(SOL_SOCKET, SO_BUSY_POLL, microseconds);
+#else
+        (void)microseconds;
+        return SOCKET_STATUS_FAILED;
+#endif
+    }
+
+    int SocketUdp::Impl::set_option(int level, int name, int value) {
+        if (!_opened) {
+            return SOCKET_STATUS_FAILED;
+        }
+
+        // Lock
+        unique_lock<mutex> socket_lock(_socket_mutex);
+
+        auto status = SETSOCKOPT(_socket, level, name, &value, sizeof(value));
+        return status == 0 ? SOCKET_STATUS_OK : SOCKET_STATUS_FAILED;
+    }
+
+    int SocketUdp::Impl::wait_readable(unsigned int timeout) {
+#ifdef SOCKET_USE_EPOLL
+        if (_epoll < 0) {
+            _epoll = epoll_create1(EPOLL_CLOEXEC);
+            if (_epoll < 0) {
+                return -1;
+            }
+
+            struct epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = _socket;
+            if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _socket, &event) < 0) {
+                auto error = errno;
+                ::close(_epoll);
+                _epoll = -1;
+                errno = error;
+                return -1;
+            }
+        }
+
+        struct epoll_event event;
+        return epoll_wait(_epoll, &event, 1, timeout == 0 ? -1 : static_cast<int>(timeout));
+#else
+        fd_set set;
+        struct timeval tv_timeout;
+
+        tv_timeout.tv_sec = timeout / 1000;
+        tv_timeout.tv_usec = (timeout % 1000) * 1000;
+
+        FD_ZERO(&set);
+        FD_SET(_socket, &set);
+
+        // only the socket itself has to be scanned, windows ignores the first argument
+        return SELECT(_socket + 1, &set, nullptr, nullptr, timeout == 0 ? NULL : &tv_timeout);
+#endif
+    }
+
     void SocketUdp::Impl::thread_send_data(string data, support::SocketAddress address_remote, SocketCallback callback) {
         SocketError error("", SOCKET_STATUS_OK);
 
@@ -39,6 +39,8 @@ namespace huestream {
                 speed));
         MOCK_METHOD1(SetPlayer, void(PlayerPtr
                 player));
+        MOCK_METHOD1(BakeAnimations, void(const AnimationBaker
+                &baker));
 
         MOCK_CONST_METHOD1(Serialize, void(JSONNode
                 *node));
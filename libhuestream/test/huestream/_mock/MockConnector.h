@@ -20,6 +20,9 @@ namespace huestream {
         MOCK_METHOD2(Connect, bool(BridgePtr bridge, unsigned short port));
         MOCK_METHOD0(Disconnect, void());
         MOCK_METHOD2(Send, bool(const char *buffer, unsigned int bufferSize));
+        MOCK_METHOD1(SetAsyncSend, bool(bool enabled));
+        MOCK_METHOD1(SetSocketOptions, void(const SocketOptions &options));
+        MOCK_CONST_METHOD0(GetDroppedFrameCount, int64_t());
     };
 
     class MockWrapperConnector : public IConnector {
@@ -39,6 +42,18 @@ namespace huestream {
             return _mock->Send(buffer, bufferSize);
         }
 
+        bool SetAsyncSend(bool enabled) {
+            return _mock->SetAsyncSend(enabled);
+        }
+
+        void SetSocketOptions(const SocketOptions &options) {
+            _mock->SetSocketOptions(options);
+        }
+
+        int64_t GetDroppedFrameCount() const {
+            return _mock->GetDroppedFrameCount();
+        }
+
     private:
         std::shared_ptr<MockConnector> _mock;
     };
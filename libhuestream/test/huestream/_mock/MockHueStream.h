@@ -49,7 +49,12 @@ namespace huestream {
         MOCK_METHOD0(LockMixer, void());
         MOCK_METHOD0(UnlockMixer, void());
         MOCK_METHOD1(AddEffect, void(EffectPtr newEffect));
+        MOCK_METHOD1(AddEffectAsync, void(EffectPtr newEffect));
+        MOCK_METHOD1(EnqueueMixerCommand, void(MixerCommand command));
         MOCK_METHOD1(AddLightScript, void(LightScriptPtr script));
+        MOCK_METHOD1(AddLightScriptStream, void(LightScriptStreamPtr stream));
+        MOCK_METHOD1(SetRenderProfilingEnabled, void(bool enabled));
+        MOCK_METHOD0(GetRenderProfile, RenderProfilePtr());
         MOCK_METHOD1(GetEffectByName, EffectPtr(const std::string &name));
         MOCK_METHOD0(ShutDown, void());
         MOCK_METHOD0(PrepareRenderMixer, void());
@@ -25,6 +25,8 @@ namespace huestream {
         MOCK_METHOD1(GetEffectByName, EffectPtr(std::string name));
         MOCK_METHOD0(Lock, void());
         MOCK_METHOD0(Unlock, void());
+        MOCK_METHOD1(Enqueue, void(MixerCommand command));
+        MOCK_METHOD0(GetProfiler, RenderProfilerPtr());
     };
 
     class MockWrapperMixer : public IMixer {
@@ -64,6 +66,14 @@ namespace huestream {
             _mock->Unlock();
         }
 
+        void Enqueue(MixerCommand command) {
+            _mock->Enqueue(command);
+        }
+
+        RenderProfilerPtr GetProfiler() {
+            return _mock->GetProfiler();
+        }
+
     private:
         std::shared_ptr<MockMixer> _mock;
     };
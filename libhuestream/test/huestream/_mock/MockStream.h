@@ -37,6 +37,8 @@ namespace huestream {
 
         MOCK_CONST_METHOD0(GetStreamCounter, int32_t());
 
+        MOCK_CONST_METHOD0(GetFrameStatistics, FrameStatistics());
+
         MOCK_METHOD1(UpdateBridgeGroup, void(BridgePtr bridge));
     };
 
@@ -81,6 +83,10 @@ namespace huestream {
             return _mock->GetStreamCounter();
         }
 
+        FrameStatistics GetFrameStatistics() const {
+            return _mock->GetFrameStatistics();
+        }
+
         void UpdateBridgeGroup(BridgePtr bridge) {
             _mock->UpdateBridgeGroup(bridge);
         }
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/common/serialize/BinaryNode.h>
+#include <huestream/common/serialize/BinaryWriter.h>
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+using namespace huestream;
+
+class TestBinaryNode : public testing::Test {
+ protected:
+    void SetUp() override {
+        _json = libjson::parse(
+            "{\"type\":\"huestream.Test\",\"Number\":1.5,\"Bool\":true,\"Text\":\"hello\",\"Null\":null,"
+            "\"Numbers\":[1,2.5,-3],\"Mixed\":[1,\"a\",{\"Key\":2}],\"Empty\":[],\"Object\":{},"
+            "\"Points\":[{\"type\":\"huestream.Point\",\"x\":0,\"y\":0.25},"
+            "{\"type\":\"huestream.Point\",\"x\":100,\"y\":0.5},"
+            "{\"type\":\"huestream.Point\",\"x\":200,\"y\":0.75}]}");
+        _data = BinaryWriter::Write(_json);
+    }
+
+    JSONNode _json;
+    std::vector<uint8_t> _data;
+};
+
+TEST_F(TestBinaryNode, ConvertsBackToSameJson) {
+    auto root = BinaryNode::Open(_data.data(), _data.size());
+    ASSERT_TRUE(root.IsValid());
+    EXPECT_EQ(_json.write(), root.ToJson().write());
+}
+
+TEST_F(TestBinaryNode, AttributesCanBeReadWithoutConversion) {
+    auto root = BinaryNode::Open(_data.data(), _data.size());
+    ASSERT_EQ(BinaryNode::Type::Object, root.GetType());
+    EXPECT_EQ(10, root.Size());
+    EXPECT_STREQ("type", root.GetName(0));
+    EXPECT_STREQ("huestream.Test", root.At(0).AsString());
+    EXPECT_DOUBLE_EQ(1.5, root.Find("Number").AsNumber());
+    EXPECT_TRUE(root.Find("Bool").AsBool());
+    EXPECT_STREQ("hello", root.Find("Text").AsString());
+    EXPECT_EQ(BinaryNode::Type::Null, root.Find("Null").GetType());
+    EXPECT_EQ(BinaryNode::Type::Invalid, root.Find("Missing").GetType());
+    EXPECT_EQ(0, root.Find("Empty").Size());
+    EXPECT_EQ(BinaryNode::Type::Object, root.Find("Object").GetType());
+
+    auto mixed = root.Find("Mixed");
+    ASSERT_EQ(3, mixed.Size());
+    EXPECT_DOUBLE_EQ(1, mixed.At(0).AsNumber());
+    EXPECT_STREQ("a", mixed.At(1).AsString());
+    EXPECT_DOUBLE_EQ(2, mixed.At(2).Find("Key").AsNumber());
+    EXPECT_EQ(nullptr, mixed.GetNumbers());
+}
+
+TEST_F(TestBinaryNode, NumericArraysPointIntoContainer) {
+    auto root = BinaryNode::Open(_data.data(), _data.size());
+    auto begin = reinterpret_cast<const double *>(_data.data());
+    auto end = reinterpret_cast<const double *>(_data.data() + _data.size());
+
+    auto numbers = root.Find("Numbers");
+    ASSERT_EQ(BinaryNode::Type::Array, numbers.GetType());
+    auto values = numbers.GetNumbers();
+    ASSERT_NE(nullptr, values);
+    EXPECT_TRUE(values >= begin && values + 3 <= end);
+    EXPECT_DOUBLE_EQ(2.5, values[1]);
+    EXPECT_DOUBLE_EQ(-3, numbers.At(2).AsNumber());
+
+    auto points = root.Find("Points");
+    ASSERT_EQ(3, points.Size());
+    auto x = points.GetColumn("x");
+    auto y = points.GetColumn("y");
+    ASSERT_NE(nullptr, x);
+    ASSERT_NE(nullptr, y);
+    EXPECT_TRUE(x >= begin && x + 3 <= end);
+    EXPECT_DOUBLE_EQ(200, x[2]);
+    EXPECT_DOUBLE_EQ(0.5, y[1]);
+    EXPECT_EQ(nullptr, points.GetColumn("type"));
+
+    auto point = points.At(1);
+    ASSERT_EQ(BinaryNode::Type::Object, point.GetType());
+    EXPECT_STREQ("huestream.Point", point.Find("type").AsString());
+    EXPECT_DOUBLE_EQ(100, point.Find("x").AsNumber());
+}
+
+TEST_F(TestBinaryNode, IncompatibleDataIsRejected) {
+    EXPECT_FALSE(BinaryNode::Open(nullptr, 0).IsValid());
+    EXPECT_FALSE(BinaryNode::Open(_data.data(), 16).IsValid());
+    EXPECT_FALSE(BinaryNode::Open(_data.data(), _data.size() - 8).IsValid());
+
+    auto text = std::vector<uint8_t>(_data.size());
+    auto json = _json.write();
+    memcpy(text.data(), json.data(), std::min(json.size(), text.size()));
+    EXPECT_FALSE(BinaryNode::Open(text.data(), text.size()).IsValid());
+
+    auto newerVersion = _data;
+    newerVersion[4] = BinaryNode::VersionMajor + 1;
+    EXPECT_FALSE(BinaryNode::Open(newerVersion.data(), newerVersion.size()).IsValid());
+}
+
+TEST_F(TestBinaryNode, CorruptOffsetsDoNotReadOutsideContainer) {
+    auto root = BinaryNode::Open(_data.data(), _data.size());
+    auto corrupt = _data;
+    auto corruptRoot = BinaryNode::Open(corrupt.data(), corrupt.size());
+    ASSERT_TRUE(corruptRoot.IsValid());
+
+    for (size_t offset = 40; offset + 8 <= corrupt.size(); offset += 8) {
+        corrupt = _data;
+        uint64_t invalid = 0xffffffff0;
+        memcpy(corrupt.data() + offset, &invalid, sizeof(invalid));
+        corruptRoot = BinaryNode::Open(corrupt.data(), corrupt.size());
+        corruptRoot.ToJson();
+        corruptRoot.Find("Points").GetColumn("x");
+    }
+    EXPECT_TRUE(root.IsValid());
+}
@@ -72,6 +72,29 @@ TEST_F(TestColor, GetRGBA) {
     ASSERT_EQ(color.GetR(),     rgba[0]);
 }
 
+TEST_F(TestColor, RGBToXYBrightness) {
+    std::vector<Color> colors = {Color(1.0, 0.0, 0.0), Color(0.0, 1.0, 0.0), Color(0.0, 0.0, 1.0),
+                                 Color(1.0, 1.0, 1.0), Color(0.3, 0.6, 0.05), Color(0.01, 0.02, 0.03),
+                                 Color(0.0, 0.0, 0.0)};
+    std::vector<double> r, g, b;
+    for (const auto& c : colors) {
+        r.push_back(c.GetR());
+        g.push_back(c.GetG());
+        b.push_back(c.GetB());
+    }
+    std::vector<double> x(colors.size()), y(colors.size()), bri(colors.size());
+
+    Color::RGBToXYBrightness(r.data(), g.data(), b.data(), x.data(), y.data(), bri.data(), colors.size());
+
+    for (size_t i = 0; i < colors.size(); ++i) {
+        double expectedY, expectedX, expectedy;
+        colors[i].GetYxy(expectedY, expectedX, expectedy);
+        EXPECT_NEAR(expectedX, x[i], 0.00001);
+        EXPECT_NEAR(expectedy, y[i], 0.00001);
+        EXPECT_DOUBLE_EQ(colors[i].GetCurrentBrightness(), bri[i]);
+    }
+}
+
 
 
 typedef std::function<void(Color)> callback;
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "huestream/common/data/SpatialIndex.h"
+#include "huestream/common/util/Rand.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace huestream;
+
+class TestSpatialIndex : public testing::Test {
+protected:
+    std::vector<double> _x;
+    std::vector<double> _y;
+    std::vector<double> _z;
+    SpatialIndex _index;
+
+    void BuildRandom(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            _x.push_back(Rand(-1, 1));
+            _y.push_back(Rand(-1, 1));
+            _z.push_back(Rand(-1, 1));
+        }
+        _index.Build(_x.data(), _y.data(), _z.data(), count);
+    }
+
+    std::vector<size_t> Sorted(std::vector<size_t> indices) {
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+};
+
+TEST_F(TestSpatialIndex, EmptyIndex) {
+    _index.Build(nullptr, nullptr, nullptr, 0);
+
+    std::vector<size_t> indices;
+    _index.QueryCircle(0, 0, 10, &indices);
+    _index.QueryBox(Location(-1, -1, -1), Location(1, 1, 1), &indices);
+    EXPECT_EQ(0, _index.Size());
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(TestSpatialIndex, LightsOnSamePosition) {
+    _x.assign(3, 0.5);
+    _y.assign(3, 0.5);
+    _z.assign(3, 0);
+    _index.Build(_x.data(), _y.data(), _z.data(), 3);
+
+    std::vector<size_t> indices;
+    _index.QueryCircle(0.4, 0.4, 0.2, &indices);
+    EXPECT_EQ(std::vector<size_t>({0, 1, 2}), Sorted(indices));
+
+    indices.clear();
+    _index.QueryCircle(0, 0, 0.5, &indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(TestSpatialIndex, QueriesMatchBruteForce) {
+    BuildRandom(200);
+
+    for (int query = 0; query < 50; ++query) {
+        auto cx = Rand(-1.2, 1.2);
+        auto cy = Rand(-1.2, 1.2);
+        auto cz = Rand(-1.2, 1.2);
+        auto radius = Rand(0, 0.8);
+        auto min = Location(cx - radius, cy - radius / 2, cz - radius);
+        auto max = Location(cx + radius / 2, cy + radius, cz + radius / 3);
+
+        std::vector<size_t> expectedCircle, expectedSphere, expectedBox;
+        for (size_t i = 0; i < _x.size(); ++i) {
+            auto dx = _x[i] - cx;
+            auto dy = _y[i] - cy;
+            auto dz = _z[i] - cz;
+            if (dx * dx + dy * dy <= radius * radius) {
+                expectedCircle.push_back(i);
+            }
+            if (dx * dx + dy * dy + dz * dz <= radius * radius) {
+                expectedSphere.push_back(i);
+            }
+            if (_x[i] >= min.GetX() && _x[i] <= max.GetX() && _y[i] >= min.GetY() && _y[i] <= max.GetY() &&
+                _z[i] >= min.GetZ() && _z[i] <= max.GetZ()) {
+                expectedBox.push_back(i);
+            }
+        }
+
+        std::vector<size_t> circle, sphere, box;
+        _index.QueryCircle(cx, cy, radius, &circle);
+        _index.QuerySphere(Location(cx, cy, cz), radius, &sphere);
+        _index.QueryBox(min, max, &box);
+        EXPECT_EQ(expectedCircle, Sorted(circle));
+        EXPECT_EQ(expectedSphere, Sorted(sphere));
+        EXPECT_EQ(expectedBox, Sorted(box));
+    }
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <huestream/common/storage/BinaryFileStorageAccessor.h>
+#include <huestream/effect/animation/animations/CurveAnimation.h>
+#include <huestream/effect/animation/animations/FramesAnimation.h>
+#include <huestream/effect/animation/animations/TweenAnimation.h>
+#include <huestream/effect/effects/AreaEffect.h>
+#include <huestream/effect/lightscript/LightScript.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace huestream;
+
+class TestBinaryFileStorageAccessor : public testing::Test {
+public:
+    std::string _fileName;
+
+    void SetUp() override {
+        _fileName = "TestBinaryFileStorageAccessor.bin";
+    }
+
+    void TearDown() override {
+        std::remove(_fileName.c_str());
+    }
+
+    static LightScriptPtr CreateScript(int pointCount = 500) {
+        auto script = std::make_shared<LightScript>("script", 60000);
+
+        auto points = std::make_shared<PointList>();
+        for (int i = 0; i < pointCount; ++i) {
+            points->push_back(std::make_shared<Point>(i * 100, (i % 10) / 10.0));
+        }
+        auto frames = std::make_shared<FramesAnimation>(25);
+        for (int i = 0; i < 250; ++i) {
+            frames->Append((i % 50) / 50.0);
+        }
+
+        auto effect = std::make_shared<AreaEffect>("area", 1);
+        effect->AddArea(Area::Left);
+        effect->SetColorAnimation(std::make_shared<CurveAnimation>(0, points), frames,
+                                  std::make_shared<TweenAnimation>(0, 1, 2000, TweenType::EaseInOutSine));
+        script->AddAction(std::make_shared<Action>("action", 1, effect, 1000));
+        return script;
+    }
+};
+
+TEST_F(TestBinaryFileStorageAccessor, SaveLoad_LightScript) {
+    auto script = CreateScript();
+    auto accessor = std::make_shared<BinaryFileStorageAccessor>(_fileName);
+
+    auto saveResult = OPERATION_FAILED;
+    accessor->Save(script, [&saveResult](OperationResult result) {
+        saveResult = result;
+    });
+    ASSERT_EQ(OPERATION_SUCCESS, saveResult);
+
+    SerializablePtr loaded;
+    accessor->Load([&loaded](OperationResult result, SerializablePtr serializable) {
+        ASSERT_EQ(OPERATION_SUCCESS, result);
+        loaded = serializable;
+    });
+
+    ASSERT_NE(nullptr, loaded);
+    ASSERT_EQ(LightScript::type, loaded->GetTypeName());
+    EXPECT_EQ(script->SerializeText(), loaded->SerializeText());
+
+    std::ifstream file(_fileName, std::ios::binary | std::ios::ate);
+    EXPECT_LT(static_cast<size_t>(file.tellg()), script->SerializeText().size());
+}
+
+TEST_F(TestBinaryFileStorageAccessor, Load_MissingFile) {
+    auto accessor = std::make_shared<BinaryFileStorageAccessor>(_fileName);
+    auto loadResult = OPERATION_SUCCESS;
+    accessor->Load([&loadResult](OperationResult result, SerializablePtr serializable) {
+        loadResult = result;
+        EXPECT_EQ(nullptr, serializable);
+    });
+    EXPECT_EQ(OPERATION_FAILED, loadResult);
+}
+
+TEST_F(TestBinaryFileStorageAccessor, Load_JsonFile) {
+    std::ofstream file(_fileName);
+    file << CreateScript()->SerializeText();
+    file.close();
+
+    auto accessor = std::make_shared<BinaryFileStorageAccessor>(_fileName);
+    auto loadResult = OPERATION_SUCCESS;
+    accessor->Load([&loadResult](OperationResult result, SerializablePtr /*serializable*/) {
+        loadResult = result;
+    });
+    EXPECT_EQ(OPERATION_FAILED, loadResult);
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestBinaryFileStorageAccessor, DISABLED_LoadBenchmark) {
+    auto script = CreateScript(50000);
+    auto jsonFileName = _fileName + ".json";
+    std::ofstream jsonFile(jsonFileName);
+    jsonFile << script->SerializeText();
+    jsonFile.close();
+    auto accessor = std::make_shared<BinaryFileStorageAccessor>(_fileName);
+    accessor->Save(script, [](OperationResult result) {
+        ASSERT_EQ(OPERATION_SUCCESS, result);
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::ifstream textFile(jsonFileName);
+    std::string text((std::istreambuf_iterator<char>(textFile)), std::istreambuf_iterator<char>());
+    auto fromJson = Serializable::DeserializeFromJsonText(text);
+    auto jsonDuration = std::chrono::steady_clock::now() - start;
+
+    SerializablePtr fromBinary;
+    start = std::chrono::steady_clock::now();
+    accessor->Load([&fromBinary](OperationResult /*result*/, SerializablePtr serializable) {
+        fromBinary = serializable;
+    });
+    auto binaryDuration = std::chrono::steady_clock::now() - start;
+    std::remove(jsonFileName.c_str());
+
+    ASSERT_NE(nullptr, fromJson);
+    ASSERT_NE(nullptr, fromBinary);
+    EXPECT_EQ(fromJson->SerializeText(), fromBinary->SerializeText());
+    std::cout << "[ BENCHMARK] load script with 50000 curve points from json: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(jsonDuration).count()
+              << " ms, binary: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(binaryDuration).count()
+              << " ms" << std::endl;
+}
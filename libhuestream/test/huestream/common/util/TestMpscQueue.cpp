@@ -0,0 +1,85 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include <huestream/common/util/MpscQueue.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace huestream;
+
+class TestMpscQueue : public testing::Test {
+};
+
+TEST_F(TestMpscQueue, PopFromEmptyQueue) {
+    MpscQueue<int> queue;
+    int value = 0;
+    EXPECT_FALSE(queue.Pop(&value));
+}
+
+TEST_F(TestMpscQueue, ItemsArePoppedInPushOrder) {
+    MpscQueue<int> queue;
+    for (int i = 0; i < 10; ++i) {
+        queue.Push(i);
+    }
+
+    int value = -1;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(queue.Pop(&value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(queue.Pop(&value));
+}
+
+TEST_F(TestMpscQueue, ItemsLeftInQueueAreReleased) {
+    auto item = std::make_shared<int>(1);
+    {
+        MpscQueue<std::shared_ptr<int>> queue;
+        queue.Push(item);
+        queue.Push(item);
+        EXPECT_EQ(3, item.use_count());
+    }
+    EXPECT_EQ(1, item.use_count());
+}
+
+TEST_F(TestMpscQueue, ConcurrentProducers) {
+    const int producerCount = 4;
+    const int itemsPerProducer = 10000;
+    MpscQueue<int> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < itemsPerProducer; ++i) {
+                queue.Push(p * itemsPerProducer + i);
+            }
+        });
+    }
+
+    std::vector<int> lastPerProducer(producerCount, -1);
+    int received = 0;
+    int value = 0;
+    while (received < producerCount * itemsPerProducer) {
+        if (!queue.Pop(&value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto producer = value / itemsPerProducer;
+        auto sequence = value % itemsPerProducer;
+        EXPECT_GT(sequence, lastPerProducer[producer]);
+        lastPerProducer[producer] = sequence;
+        received++;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(queue.Pop(&value));
+    for (int p = 0; p < producerCount; ++p) {
+        EXPECT_EQ(itemsPerProducer - 1, lastPerProducer[p]);
+    }
+}
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "huestream/effect/animation/animations/ConstantAnimation.h"
+#include "huestream/effect/effects/AreaEffect.h"
+#include "huestream/effect/lightscript/ActionScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace huestream;
+
+class TestActionScheduler : public testing::Test {
+public:
+    ActionList _actions;
+
+    void AddAction(int64_t startPosition, double length, int64_t endPosition = -1) {
+        auto effect = std::make_shared<AreaEffect>();
+        effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1.0, length));
+        _actions.push_back(std::make_shared<Action>("action", 0, effect, startPosition, endPosition));
+    }
+
+    std::vector<size_t> GetActiveActions(const ActionScheduler &scheduler, int64_t position) {
+        std::vector<size_t> indices;
+        scheduler.GetActiveActions(position, &indices);
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    std::vector<size_t> GetActiveActionsByScanning(int64_t position) {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < _actions.size(); ++i) {
+            if (position > _actions[i]->GetStartPosition() && position < _actions[i]->GetCalculatedEndPosition()) {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    }
+};
+
+TEST_F(TestActionScheduler, EmptyScheduler) {
+    ActionScheduler scheduler;
+    scheduler.Build(_actions);
+    EXPECT_EQ(0u, scheduler.Size());
+    EXPECT_TRUE(GetActiveActions(scheduler, 0).empty());
+}
+
+TEST_F(TestActionScheduler, FindsOverlappingActions) {
+    AddAction(1000, 1000);
+    AddAction(0, 500);
+    AddAction(500, INF);
+    AddAction(1500, INF, 3000);
+    AddAction(200, 5000, 1200);
+
+    ActionScheduler scheduler;
+    scheduler.Build(_actions);
+    EXPECT_EQ(5u, scheduler.Size());
+
+    EXPECT_EQ(std::vector<size_t>(), GetActiveActions(scheduler, 0));
+    EXPECT_EQ(std::vector<size_t>({1, 4}), GetActiveActions(scheduler, 250));
+    EXPECT_EQ(std::vector<size_t>({4}), GetActiveActions(scheduler, 500));
+    EXPECT_EQ(std::vector<size_t>({0, 2, 4}), GetActiveActions(scheduler, 1100));
+    EXPECT_EQ(std::vector<size_t>({0, 2, 3}), GetActiveActions(scheduler, 1600));
+    EXPECT_EQ(std::vector<size_t>({2, 3}), GetActiveActions(scheduler, 2000));
+    EXPECT_EQ(std::vector<size_t>({2}), GetActiveActions(scheduler, 1000000));
+}
+
+TEST_F(TestActionScheduler, ChangedActionsInvalidateSchedules) {
+    AddAction(0, 500);
+    auto generation = Action::GetScheduleGeneration();
+
+    _actions[0]->SetEndPosition(1200);
+    EXPECT_NE(generation, Action::GetScheduleGeneration());
+
+    generation = Action::GetScheduleGeneration();
+    _actions[0]->SetTimeProvider(nullptr);
+    EXPECT_NE(generation, Action::GetScheduleGeneration());
+
+    generation = Action::GetScheduleGeneration();
+    _actions[0]->Render();
+    _actions[0]->IsEnabled();
+    EXPECT_EQ(generation, Action::GetScheduleGeneration());
+}
+
+TEST_F(TestActionScheduler, MatchesScanningAllActions) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int64_t> start(0, 100000);
+    std::uniform_int_distribution<int> length(1, 3000);
+    for (int i = 0; i < 2000; ++i) {
+        AddAction(start(random), length(random));
+    }
+
+    ActionScheduler scheduler;
+    scheduler.Build(_actions);
+
+    std::uniform_int_distribution<int64_t> position(-100, 105000);
+    for (int i = 0; i < 1000; ++i) {
+        auto p = position(random);
+        ASSERT_EQ(GetActiveActionsByScanning(p), GetActiveActions(scheduler, p)) << "position " << p;
+    }
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestActionScheduler, DISABLED_Benchmark) {
+    for (int i = 0; i < 5000; ++i) {
+        AddAction(i * 720, 1000);
+    }
+    ActionScheduler scheduler;
+    scheduler.Build(_actions);
+
+    const int frames = 500;
+    size_t scanned = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        scanned += GetActiveActionsByScanning(frame * 1800).size();
+    }
+    auto scanTime = std::chrono::steady_clock::now() - begin;
+
+    size_t found = 0;
+    std::vector<size_t> indices;
+    begin = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        indices.clear();
+        scheduler.GetActiveActions(frame * 1800, &indices);
+        found += indices.size();
+    }
+    auto lookupTime = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_EQ(scanned, found);
+    std::cout << "[ BENCHMARK] active actions of 5000 for " << frames << " frames, scanning: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(scanTime).count() << " us, scheduler: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(lookupTime).count() << " us" << std::endl;
+}
@@ -115,6 +115,18 @@ TEST_F(TestLightScript, SetActionsOrdersList) {
     ASSERT_EQ(_lightscript->GetActions()->at(3)->GetName(), "name4");
 
 }
+
+TEST_F(TestLightScript, BakeAnimationsBakesAllEffects) {
+    auto effect = std::make_shared<MockAnimationEffect>("effect", 0);
+    auto actionsIn = std::make_shared<ActionList>();
+    actionsIn->push_back(std::make_shared<Action>("name1", 0, effect, 20, 40));
+    actionsIn->push_back(std::make_shared<Action>("name2", 0, nullptr, 40, 50));
+    _lightscript->SetActions(actionsIn);
+
+    AnimationBaker baker(25);
+    EXPECT_CALL(*effect, BakeAnimations(testing::Ref(baker)));
+    _lightscript->BakeAnimations(baker);
+}
 /******************************************************************************/
 /*                                 END OF FILE                                */
 /******************************************************************************/
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "huestream/common/storage/BinaryFileStorageAccessor.h"
+#include "huestream/effect/animation/animations/ConstantAnimation.h"
+#include "huestream/effect/effects/AreaEffect.h"
+#include "huestream/effect/lightscript/LightScriptStream.h"
+#include "huestream/effect/lightscript/Timeline.h"
+#include "test/huestream/_stub/StubTimeProvider.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+using namespace huestream;
+
+class TestLightScriptStream : public testing::Test {
+public:
+    std::string _fileName;
+
+    void SetUp() override {
+        _fileName = "TestLightScriptStream.bin";
+    }
+
+    void TearDown() override {
+        std::remove(_fileName.c_str());
+    }
+
+    // actions of one second, starting every second, alternating between two layers
+    void SaveScript(int actionCount) {
+        auto script = std::make_shared<LightScript>("script", actionCount * 1000);
+        for (int i = 0; i < actionCount; ++i) {
+            auto effect = std::make_shared<AreaEffect>("effect" + std::to_string(i));
+            effect->AddArea(Area::All);
+            effect->SetFixedColor(Color(1.0, 0.0, 0.0));
+            effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1, 1000));
+            script->AddAction(std::make_shared<Action>("action" + std::to_string(i), i % 2, effect, i * 1000));
+        }
+
+        auto saveResult = OPERATION_FAILED;
+        std::make_shared<BinaryFileStorageAccessor>(_fileName)->Save(script, [&saveResult](OperationResult result) {
+            saveResult = result;
+        });
+        ASSERT_EQ(OPERATION_SUCCESS, saveResult);
+    }
+};
+
+TEST_F(TestLightScriptStream, OpenIndexesWithoutLoadingActions) {
+    SaveScript(100);
+
+    LightScriptStream stream(_fileName, 2000);
+    ASSERT_TRUE(stream.IsValid());
+    EXPECT_EQ(100u, stream.GetActionCount());
+    EXPECT_EQ("script", stream.GetScript()->GetName());
+    EXPECT_EQ(100000, stream.GetScript()->GetLength());
+    EXPECT_TRUE(stream.GetScript()->GetActions()->empty());
+    EXPECT_FALSE(stream.IsEnded());
+}
+
+TEST_F(TestLightScriptStream, OpenInvalidFile) {
+    LightScriptStream missing(_fileName);
+    EXPECT_FALSE(missing.IsValid());
+    EXPECT_TRUE(missing.IsEnded());
+
+    auto saveResult = OPERATION_FAILED;
+    std::make_shared<BinaryFileStorageAccessor>(_fileName)->Save(std::make_shared<Location>(0.1, 0.2),
+        [&saveResult](OperationResult result) {
+            saveResult = result;
+        });
+    ASSERT_EQ(OPERATION_SUCCESS, saveResult);
+
+    LightScriptStream location(_fileName);
+    EXPECT_FALSE(location.IsValid());
+}
+
+TEST_F(TestLightScriptStream, UpdateLoadsLookaheadWindowAndReleasesEndedActions) {
+    SaveScript(100);
+    LightScriptStream stream(_fileName, 2000);
+
+    auto loaded = stream.Update(0);
+    ASSERT_EQ(3u, loaded->size());
+    EXPECT_EQ("action0", loaded->at(0)->GetName());
+    EXPECT_EQ("action1", loaded->at(1)->GetName());
+    EXPECT_EQ(1u, loaded->at(1)->GetLayer());
+    EXPECT_EQ("action2", loaded->at(2)->GetName());
+    EXPECT_EQ(3u, stream.GetScript()->GetActions()->size());
+
+    auto first = loaded->at(0);
+    loaded = stream.Update(1500);
+    ASSERT_EQ(1u, loaded->size());
+    EXPECT_EQ("action3", loaded->at(0)->GetName());
+    EXPECT_TRUE(first->IsFinished());
+    EXPECT_EQ(3u, stream.GetScript()->GetActions()->size());
+
+    for (int64_t position = 2000; position < 100000; position += 40) {
+        stream.Update(position);
+        EXPECT_LE(stream.GetScript()->GetActions()->size(), 4u);
+    }
+    EXPECT_FALSE(stream.IsEnded());
+
+    EXPECT_TRUE(stream.Update(100000)->empty());
+    EXPECT_TRUE(stream.IsEnded());
+}
+
+TEST_F(TestLightScriptStream, SeekBackwardsReloadsActions) {
+    SaveScript(100);
+    LightScriptStream stream(_fileName, 2000);
+
+    auto loaded = stream.Update(50500);
+    ASSERT_EQ(3u, loaded->size());
+    EXPECT_EQ("action50", loaded->at(0)->GetName());
+    auto action50 = loaded->at(0);
+
+    loaded = stream.Update(10500);
+    ASSERT_EQ(3u, loaded->size());
+    EXPECT_EQ("action10", loaded->at(0)->GetName());
+    EXPECT_EQ("action12", loaded->at(2)->GetName());
+    EXPECT_TRUE(action50->IsFinished());
+    EXPECT_EQ(3u, stream.GetScript()->GetActions()->size());
+}
+
+TEST_F(TestLightScriptStream, UpdateFollowsBoundTimeline) {
+    SaveScript(10);
+    LightScriptStream stream(_fileName, 500);
+
+    EXPECT_TRUE(stream.Update()->empty());
+
+    auto timeProvider = std::make_shared<StubTimeProvider>();
+    auto timeline = std::make_shared<Timeline>(timeProvider);
+    stream.BindTimeline(timeline);
+    EXPECT_EQ(timeline, stream.GetTimeline());
+
+    auto loaded = stream.Update();
+    ASSERT_EQ(1u, loaded->size());
+
+    timeline->Start();
+    timeProvider->AddMilliseconds(500);
+    loaded = stream.Update();
+    ASSERT_EQ(1u, loaded->size());
+    EXPECT_EQ("action1", loaded->at(0)->GetName());
+    EXPECT_FALSE(loaded->at(0)->IsEnabled());
+    EXPECT_TRUE(stream.GetScript()->GetActions()->at(0)->IsEnabled());
+}
@@ -4,11 +4,22 @@
  ********************************************************************************/
 
 #include "gtest/gtest.h"
+#include <chrono>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 
+#include "huestream/common/time/FrameTime.h"
+#include "huestream/common/time/TimeProviderProvider.h"
 #include "huestream/effect/Mixer.h"
+#include "huestream/effect/animation/animations/ConstantAnimation.h"
+#include "huestream/effect/effects/AreaEffect.h"
+#include "huestream/effect/effects/LightSourceEffect.h"
+#include "huestream/effect/lightscript/Action.h"
 #include "test/huestream/_mock/MockEffect.h"
 #include "test/huestream/_mock/MockTimeline.h"
+#include "test/huestream/_stub/StubTimeProvider.h"
 
 using ::testing::Return;
 using ::testing::_;
@@ -17,6 +28,7 @@ using ::testing::Property;
 using ::testing::AllOf;
 using ::testing::Pointee;
 using ::testing::Values;
+using ::testing::Invoke;
 using namespace huestream;
 
 class TestMixer : public testing::TestWithParam<bool> {
@@ -55,6 +67,7 @@ protected:
         auto effect = std::make_shared<MockEffect>("testEffect");
         effect->SetLayer(layer);
         EXPECT_CALL(*effect, UpdateGroup(_group));
+        EXPECT_CALL(*effect, GetTypeName()).WillRepeatedly(Return("MockEffect"));
         _mixer->AddEffect(effect);
         effect->Enable();
         EXPECT_CALL(*effect, Render());
@@ -69,6 +82,7 @@ protected:
         _sequences.push_back(Sequence());
         _effects.push_back(effect);
         EXPECT_CALL(*effect, UpdateGroup(_group));
+        EXPECT_CALL(*effect, GetTypeName()).WillRepeatedly(Return("MockEffect"));
         _mixer->AddEffect(effect);
     }
 
@@ -257,6 +271,233 @@ TEST_F(TestMixer, IsRobustAgainstInvalidGroup) {
     _mixer->SetGroup(nullptr);
 }
 
+TEST_F(TestMixer, BatchRenderedEffectsAreMixed) {
+    auto background = std::make_shared<AreaEffect>("background", EffectLayer0);
+    background->SetFixedColor(Color(0.0, 0.0, 1.0));
+    background->AddArea(Area::All);
+    _mixer->AddEffect(background);
+    background->Enable();
+
+    auto foreground = std::make_shared<LightSourceEffect>("foreground", EffectLayer1);
+    foreground->SetFixedColor(Color(1.0, 0.0, 0.0));
+    foreground->SetPositionAnimation(std::make_shared<ConstantAnimation>(0.1), std::make_shared<ConstantAnimation>(0.1));
+    foreground->SetRadiusAnimation(std::make_shared<ConstantAnimation>(1.0));
+    _mixer->AddEffect(foreground);
+    foreground->Enable();
+
+    _mixer->Render();
+
+    Colors expected;
+    for (auto light : *_group->GetLights()) {
+        auto top = foreground->GetColor(light);
+        auto alpha = top.GetAlpha();
+        expected.push_back(Color(top.GetR() * alpha, top.GetG() * alpha, 1.0 - alpha));
+    }
+    AssertColors(expected);
+}
+
+TEST_F(TestMixer, ParallelRenderIsIdenticalToSerial) {
+    auto parallelSettings = std::make_shared<AppSettings>();
+    parallelSettings->SetRenderThreads(4);
+    auto parallelMixer = std::make_shared<Mixer>(parallelSettings);
+    auto parallelGroup = std::make_shared<Group>();
+
+    for (int i = 0; i < 20; ++i) {
+        _group->AddLight(std::to_string(10 + i), -1.0 + 0.1 * i, 1.0 - 0.07 * i);
+    }
+    for (const auto& light : *_group->GetLights()) {
+        parallelGroup->AddLight(light->GetId(), light->GetPosition().GetX(), light->GetPosition().GetY());
+    }
+    parallelMixer->SetGroup(parallelGroup);
+
+    for (int i = 0; i < 60; ++i) {
+        auto effect = std::make_shared<LightSourceEffect>("effect" + std::to_string(i), i % 3);
+        effect->SetFixedColor(Color(0.01 * i, 1.0 - 0.01 * i, 0.5));
+        effect->SetFixedOpacity(0.3 + 0.01 * i);
+        effect->SetPositionAnimation(std::make_shared<ConstantAnimation>(-0.9 + 0.03 * i),
+                                     std::make_shared<ConstantAnimation>(0.5 - 0.02 * i));
+        effect->SetRadiusAnimation(std::make_shared<ConstantAnimation>(0.2 + 0.01 * i));
+        effect->Enable();
+        _mixer->AddEffect(effect);
+        parallelMixer->AddEffect(effect);
+    }
+
+    for (int frame = 0; frame < 10; ++frame) {
+        _mixer->Render();
+        parallelMixer->Render();
+
+        auto serialLights = _group->GetLights();
+        auto parallelLights = parallelGroup->GetLights();
+        ASSERT_EQ(serialLights->size(), parallelLights->size());
+        for (size_t i = 0; i < serialLights->size(); ++i) {
+            ASSERT_EQ(serialLights->at(i)->GetColor().GetR(), parallelLights->at(i)->GetColor().GetR());
+            ASSERT_EQ(serialLights->at(i)->GetColor().GetG(), parallelLights->at(i)->GetColor().GetG());
+            ASSERT_EQ(serialLights->at(i)->GetColor().GetB(), parallelLights->at(i)->GetColor().GetB());
+        }
+    }
+}
+
+class ThrowingOffRenderThreadEffect : public AreaEffect {
+ public:
+    ThrowingOffRenderThreadEffect(const std::string &name, std::thread::id renderThread)
+        : AreaEffect(name), _renderThread(renderThread) {}
+
+    void GetColors(const LightBuffer &lights, double *r, double *g, double *b, double *a) override {
+        if (std::this_thread::get_id() != _renderThread) {
+            throw std::runtime_error("effect failed on worker");
+        }
+        // leave the remaining effects to the workers
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        AreaEffect::GetColors(lights, r, g, b, a);
+    }
+
+ private:
+    std::thread::id _renderThread;
+};
+
+TEST_F(TestMixer, ParallelRenderPassesOnExceptionsOfWorkers) {
+    auto parallelSettings = std::make_shared<AppSettings>();
+    parallelSettings->SetRenderThreads(4);
+    auto parallelMixer = std::make_shared<Mixer>(parallelSettings);
+    parallelMixer->SetGroup(_group);
+
+    for (int i = 0; i < 8; ++i) {
+        auto effect = std::make_shared<ThrowingOffRenderThreadEffect>("effect" + std::to_string(i),
+                                                                      std::this_thread::get_id());
+        effect->AddArea(Area::All);
+        effect->Enable();
+        parallelMixer->AddEffect(effect);
+    }
+
+    EXPECT_THROW(parallelMixer->Render(), std::runtime_error);
+}
+
+TEST_F(TestMixer, EnqueuedCommandsAreExecutedAtNextRender) {
+    auto effect = std::make_shared<AreaEffect>("queued", EffectLayer0);
+    effect->SetFixedColor(Color(1.0, 0.0, 0.0));
+    effect->AddArea(Area::All);
+
+    auto mixer = _mixer.get();
+    _mixer->Enqueue([mixer, effect]() { mixer->AddEffect(effect); });
+    _mixer->Enqueue([effect]() { effect->Enable(); });
+    EXPECT_EQ(nullptr, _mixer->GetEffectByName("queued"));
+    EXPECT_FALSE(effect->IsEnabled());
+
+    _mixer->Render();
+
+    EXPECT_EQ(effect, _mixer->GetEffectByName("queued"));
+    EXPECT_TRUE(effect->IsEnabled());
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+}
+
+TEST_F(TestMixer, OnlyActionsOverlappingTheTimelinePositionAreEvaluated) {
+    for (int i = 0; i < 100; ++i) {
+        auto effect = std::make_shared<AreaEffect>("effect" + std::to_string(i), EffectLayer0);
+        effect->SetFixedColor(i == 1 ? Color(0.0, 0.0, 1.0) : i == 42 ? Color(1.0, 0.0, 0.0) : Color(0.0, 1.0, 0.0));
+        effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1.0, 100));
+        effect->AddArea(Area::All);
+        auto action = std::make_shared<Action>("action" + std::to_string(i), EffectLayer0, effect, i * 100);
+        action->SetTimeProvider(_mockTimeline);
+        _mixer->AddEffect(action);
+    }
+
+    // one lookup for the timeline and a few calls for the single active action, instead of one per action
+    EXPECT_CALL(*_mockTimeline, Now()).Times(testing::Between(1, 5)).WillRepeatedly(Return(4250));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+    testing::Mock::VerifyAndClearExpectations(_mockTimeline.get());
+
+    // seeking back is a lookup as well
+    EXPECT_CALL(*_mockTimeline, Now()).Times(testing::Between(1, 5)).WillRepeatedly(Return(150));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(0.0, 0.0, 1.0), Color(0.0, 0.0, 1.0)));
+    testing::Mock::VerifyAndClearExpectations(_mockTimeline.get());
+
+    EXPECT_CALL(*_mockTimeline, Now()).Times(1).WillRepeatedly(Return(20000));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(0.0, 0.0, 0.0), Color(0.0, 0.0, 0.0)));
+}
+
+TEST_F(TestMixer, ActionsAreRescheduledWhenTheirPeriodChanges) {
+    auto effect = std::make_shared<AreaEffect>("effect", EffectLayer0);
+    effect->SetFixedColor(Color(1.0, 0.0, 0.0));
+    effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1.0, 100));
+    effect->AddArea(Area::All);
+    auto action = std::make_shared<Action>("action", EffectLayer0, effect, 0);
+    action->SetTimeProvider(_mockTimeline);
+    _mixer->AddEffect(action);
+
+    EXPECT_CALL(*_mockTimeline, Now()).WillRepeatedly(Return(50));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+
+    action->SetStartPosition(1000);
+    EXPECT_CALL(*_mockTimeline, Now()).WillRepeatedly(Return(1050));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+
+    // a group change can change the length of an effect
+    effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1.0, 1000));
+    _mixer->SetGroup(_group);
+    EXPECT_CALL(*_mockTimeline, Now()).WillRepeatedly(Return(1500));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+}
+
+TEST_F(TestMixer, ActionsAreScheduledWhenTimeProviderIsSetAfterAdding) {
+    std::vector<ActionPtr> actions;
+    for (int i = 0; i < 20; ++i) {
+        auto effect = std::make_shared<AreaEffect>("effect" + std::to_string(i), EffectLayer0);
+        effect->SetFixedColor(Color(1.0, 0.0, 0.0));
+        effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(1.0, 100));
+        effect->AddArea(Area::All);
+        actions.push_back(std::make_shared<Action>("action" + std::to_string(i), EffectLayer0, effect, i * 100));
+        _mixer->AddEffect(actions.back());
+    }
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(0.0, 0.0, 0.0), Color(0.0, 0.0, 0.0)));
+
+    for (const auto &action : actions) {
+        action->SetTimeProvider(_mockTimeline);
+    }
+    EXPECT_CALL(*_mockTimeline, Now()).Times(testing::Between(1, 5)).WillRepeatedly(Return(1050));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(1.0, 0.0, 0.0), Color(1.0, 0.0, 0.0)));
+    testing::Mock::VerifyAndClearExpectations(_mockTimeline.get());
+
+    // scheduled on the timeline, so actions outside of the position are not checked anymore
+    EXPECT_CALL(*_mockTimeline, Now()).Times(1).WillRepeatedly(Return(20000));
+    _mixer->Render();
+    AssertColors(Colors::Create(2, Color(0.0, 0.0, 0.0), Color(0.0, 0.0, 0.0)));
+}
+
+TEST_F(TestMixer, AllEffectsInAFrameSeeTheSameTime) {
+    auto timeProvider = std::make_shared<StubTimeProvider>();
+    ScopedTimeProviderProvider timeProviderScope(timeProvider);
+    std::vector<int64_t> renderTimes;
+
+    for (unsigned int layer = 0; layer < 3; ++layer) {
+        auto effect = std::make_shared<MockEffect>("testEffect", layer);
+        EXPECT_CALL(*effect, UpdateGroup(_group));
+        EXPECT_CALL(*effect, GetTypeName()).WillRepeatedly(Return("MockEffect"));
+        EXPECT_CALL(*effect, IsFinished()).WillRepeatedly(Return(false));
+        EXPECT_CALL(*effect, GetColor(_)).WillRepeatedly(Return(Color()));
+        EXPECT_CALL(*effect, Render()).WillOnce(Invoke([&renderTimes, timeProvider]() {
+            renderTimes.push_back(FrameTime::Now());
+            timeProvider->AddMilliseconds(10);
+        }));
+        _mixer->AddEffect(effect);
+        effect->Enable();
+        _effects.push_back(effect);
+    }
+
+    timeProvider->AddMilliseconds(1000);
+    _mixer->Render();
+
+    EXPECT_EQ(std::vector<int64_t>({1000, 1000, 1000}), renderTimes);
+    EXPECT_EQ(1030, FrameTime::Now());
+}
+
 INSTANTIATE_TEST_CASE_P(RemoveOrRetainColorAfterEffect, TestMixer, Values(true, false));
 
 TEST_P(TestMixer, RemoveOrRetainColorAfterEffect) {
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "huestream/effect/Mixer.h"
+#include "huestream/effect/RenderProfiler.h"
+#include "huestream/effect/effects/AreaEffect.h"
+
+#include <memory>
+#include <string>
+
+using namespace huestream;
+
+class TestRenderProfiler : public testing::Test {
+public:
+    RenderProfilerPtr _profiler;
+    EffectPtr _background;
+    EffectPtr _foreground;
+
+    void SetUp() override {
+        _profiler = std::make_shared<RenderProfiler>(3);
+        _background = std::make_shared<AreaEffect>("background", 0);
+        _foreground = std::make_shared<AreaEffect>("foreground", 1);
+    }
+
+    void AddFrame(int64_t renderDuration, int64_t colorDuration) {
+        _profiler->BeginFrame();
+        _profiler->AddRender(_background, renderDuration);
+        _profiler->AddColors(_background, colorDuration);
+        _profiler->AddRender(_foreground, 2 * renderDuration);
+        _profiler->EndFrame(10000);
+    }
+};
+
+TEST_F(TestRenderProfiler, DisabledByDefault) {
+    EXPECT_FALSE(_profiler->IsEnabled());
+    _profiler->SetEnabled(true);
+    EXPECT_TRUE(_profiler->IsEnabled());
+
+    auto profile = _profiler->GetProfile();
+    EXPECT_EQ(0, profile->GetFrameCount());
+    EXPECT_TRUE(profile->GetEffects()->empty());
+}
+
+TEST_F(TestRenderProfiler, AggregatesPerEffectNameAndLayer) {
+    AddFrame(1000, 3000);
+    AddFrame(3000, 5000);
+
+    auto profile = _profiler->GetProfile();
+    EXPECT_EQ(2, profile->GetFrameCount());
+    EXPECT_EQ(20.0, profile->GetRenderTime());
+    ASSERT_EQ(2u, profile->GetEffects()->size());
+
+    auto background = profile->GetEffects()->at(0);
+    EXPECT_EQ("background", background->GetName());
+    EXPECT_EQ(0, background->GetLayer());
+    EXPECT_EQ(2, background->GetRenderCount());
+    EXPECT_EQ(4.0, background->GetRenderTime());
+    EXPECT_EQ(2, background->GetColorCount());
+    EXPECT_EQ(8.0, background->GetColorTime());
+
+    auto foreground = profile->GetEffects()->at(1);
+    EXPECT_EQ("foreground", foreground->GetName());
+    EXPECT_EQ(1, foreground->GetLayer());
+    EXPECT_EQ(2, foreground->GetRenderCount());
+    EXPECT_EQ(8.0, foreground->GetRenderTime());
+    EXPECT_EQ(0, foreground->GetColorCount());
+}
+
+TEST_F(TestRenderProfiler, KeepsLastFramesOnly) {
+    AddFrame(1000000, 0);
+    AddFrame(1000, 0);
+    AddFrame(1000, 0);
+    AddFrame(1000, 0);
+
+    auto profile = _profiler->GetProfile();
+    EXPECT_EQ(3, profile->GetFrameCount());
+    EXPECT_EQ(3.0, profile->GetEffects()->at(1)->GetRenderTime());
+
+    _profiler->Reset();
+    EXPECT_EQ(0, _profiler->GetProfile()->GetFrameCount());
+}
+
+TEST_F(TestRenderProfiler, SerializesToJson) {
+    AddFrame(1000, 3000);
+
+    auto profile = _profiler->GetProfile();
+    auto json = profile->SerializeText();
+    EXPECT_NE(std::string::npos, json.find("\"background\""));
+    EXPECT_NE(std::string::npos, json.find("\"ColorTime\""));
+
+    auto deserialized = std::static_pointer_cast<RenderProfile>(Serializable::DeserializeFromJsonText(json));
+    ASSERT_NE(nullptr, deserialized);
+    EXPECT_EQ(json, deserialized->SerializeText());
+}
+
+TEST_F(TestRenderProfiler, MixerProfilesOnlyWhenEnabled) {
+    auto mixer = std::make_shared<Mixer>();
+    auto group = std::make_shared<Group>();
+    group->AddLight("1", 0.1, 0.1);
+    mixer->SetGroup(group);
+
+    auto effect = std::make_shared<AreaEffect>("area", 2);
+    effect->AddArea(Area::All);
+    effect->SetFixedColor(Color(1.0, 0.0, 0.0));
+    effect->Enable();
+    mixer->AddEffect(effect);
+
+    mixer->Render();
+    EXPECT_EQ(0, mixer->GetProfiler()->GetProfile()->GetFrameCount());
+
+    mixer->GetProfiler()->SetEnabled(true);
+    mixer->Render();
+    mixer->Render();
+    mixer->GetProfiler()->SetEnabled(false);
+    mixer->Render();
+
+    auto profile = mixer->GetProfiler()->GetProfile();
+    EXPECT_EQ(2, profile->GetFrameCount());
+    ASSERT_EQ(1u, profile->GetEffects()->size());
+    EXPECT_EQ("area", profile->GetEffects()->at(0)->GetName());
+    EXPECT_EQ(2, profile->GetEffects()->at(0)->GetLayer());
+    EXPECT_EQ(2, profile->GetEffects()->at(0)->GetRenderCount());
+    EXPECT_EQ(2, profile->GetEffects()->at(0)->GetColorCount());
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/effect/animation/AnimationBaker.h>
+#include <huestream/effect/animation/animations/ConstantAnimation.h>
+#include <huestream/effect/animation/animations/CurveAnimation.h>
+#include <huestream/effect/animation/animations/FramesAnimation.h>
+#include <huestream/effect/animation/animations/RandomAnimation.h>
+#include <huestream/effect/animation/animations/SequenceAnimation.h>
+#include <huestream/effect/animation/animations/TweenAnimation.h>
+#include <huestream/effect/animation/data/PointHelper.h>
+#include <huestream/effect/effects/AreaEffect.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace huestream;
+
+class TestAnimationBaker : public testing::Test {
+ protected:
+    static AnimationPtr CreateCurve(double repeatTimes = 0) {
+        return std::make_shared<CurveAnimation>(repeatTimes, PointHelper::CreatePtr(
+            std::make_shared<Point>(0, 0.1),
+            std::make_shared<Point>(400, 0.9),
+            std::make_shared<Point>(1000, 0.3),
+            std::make_shared<Point>(2000, 0.6)));
+    }
+
+    static AnimationPtr CreateSequence() {
+        auto sequence = std::make_shared<SequenceAnimation>();
+        sequence->Append(std::make_shared<TweenAnimation>(0, 1, 500, TweenType::EaseInOutQuad));
+        sequence->Append(std::make_shared<ConstantAnimation>(1, 200));
+        sequence->Append(std::make_shared<TweenAnimation>(1, 0.1, 300, TweenType::EaseInOutSine));
+        sequence->Append(CreateCurve());
+        return sequence;
+    }
+
+    static void ExpectBakedMatchesLive(const AnimationPtr &animation, const AnimationPtr &baked, double tolerance) {
+        ASSERT_EQ(std::string(FramesAnimation::type), baked->GetTypeName());
+        EXPECT_DOUBLE_EQ(animation->GetTotalLength(), baked->GetTotalLength());
+
+        auto live = animation->Clone();
+        live->Rewind();
+        baked->Rewind();
+        for (double position = 0; position < animation->GetTotalLength(); position += 7) {
+            live->SetMarker(position);
+            baked->SetMarker(position);
+            EXPECT_NEAR(live->GetValue(), baked->GetValue(), tolerance) << "at " << position;
+        }
+    }
+};
+
+TEST_F(TestAnimationBaker, BakedCurveMatchesLive) {
+    auto curve = CreateCurve();
+    auto baked = AnimationBaker(100, 0.005).Bake(curve);
+    ExpectBakedMatchesLive(curve, baked, 0.005);
+}
+
+TEST_F(TestAnimationBaker, BakedSequenceMatchesLive) {
+    auto sequence = CreateSequence();
+    auto baked = AnimationBaker(100, 0.01).Bake(sequence);
+    ExpectBakedMatchesLive(sequence, baked, 0.01);
+}
+
+TEST_F(TestAnimationBaker, LinearTweenIsBakedWithDefaultSettings) {
+    AnimationPtr tween = std::make_shared<TweenAnimation>(0, 1, 1000, TweenType::Linear);
+    auto baker = AnimationBaker();
+    auto baked = baker.Bake(tween);
+    ExpectBakedMatchesLive(tween, baked, baker.GetTolerance());
+
+    baked->SetMarker(980);
+    EXPECT_NEAR(0.98, baked->GetValue(), baker.GetTolerance());
+    baked->SetMarker(1000);
+    EXPECT_NEAR(1, baked->GetValue(), baker.GetTolerance());
+}
+
+TEST_F(TestAnimationBaker, BakedAnimationKeepsRepeatTimes) {
+    auto curve = CreateCurve(2);
+    auto baked = AnimationBaker(100, 0.005).Bake(curve);
+    ASSERT_EQ(std::string(FramesAnimation::type), baked->GetTypeName());
+    EXPECT_DOUBLE_EQ(2, std::static_pointer_cast<FramesAnimation>(baked)->GetRepeatTimes());
+    ExpectBakedMatchesLive(curve, baked, 0.005);
+}
+
+TEST_F(TestAnimationBaker, BakingDoesNotChangeOriginal) {
+    auto curve = CreateCurve(2);
+    curve->SetMarker(700);
+    auto value = curve->GetValue();
+
+    AnimationBaker().Bake(curve);
+
+    EXPECT_DOUBLE_EQ(700, curve->GetMarker());
+    EXPECT_DOUBLE_EQ(value, curve->GetValue());
+    EXPECT_DOUBLE_EQ(2, std::static_pointer_cast<CurveAnimation>(curve)->GetRepeatTimes());
+}
+
+TEST_F(TestAnimationBaker, AnimationsWhichCanNotBeBakedAreKept) {
+    auto baker = AnimationBaker();
+
+    AnimationPtr animation = nullptr;
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    animation = std::make_shared<RandomAnimation>();
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    animation = std::make_shared<TweenAnimation>(1, 500, TweenType::Linear);
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    animation = std::make_shared<ConstantAnimation>(0.5);
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    animation = CreateCurve(INF);
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    animation = std::make_shared<TweenAnimation>(-1, 1, 500, TweenType::Linear);
+    EXPECT_EQ(animation, baker.Bake(animation));
+
+    auto sequence = std::static_pointer_cast<SequenceAnimation>(CreateSequence());
+    sequence->Append(CreateCurve(), "bookmark");
+    EXPECT_EQ(sequence, baker.Bake(sequence));
+}
+
+TEST_F(TestAnimationBaker, AnimationIsKeptIfToleranceIsExceeded) {
+    auto step = std::make_shared<SequenceAnimation>();
+    step->Append(std::make_shared<ConstantAnimation>(0, 500));
+    step->Append(std::make_shared<ConstantAnimation>(1, 500));
+
+    EXPECT_EQ(step, AnimationBaker(10, 0.01).Bake(step));
+    EXPECT_EQ(std::string(FramesAnimation::type), AnimationBaker(10, 1).Bake(step)->GetTypeName());
+}
+
+TEST_F(TestAnimationBaker, EffectAnimationsAreBaked) {
+    auto effect = std::make_shared<AreaEffect>();
+    effect->SetColorAnimation(CreateCurve(), CreateSequence(), std::make_shared<ConstantAnimation>(0.5));
+    auto random = std::make_shared<RandomAnimation>();
+    effect->SetOpacityAnimation(random);
+
+    effect->BakeAnimations(AnimationBaker(100, 0.01));
+
+    EXPECT_EQ(std::string(FramesAnimation::type), effect->GetR()->GetTypeName());
+    EXPECT_EQ(std::string(FramesAnimation::type), effect->GetG()->GetTypeName());
+    EXPECT_EQ(std::string(ConstantAnimation::type), effect->GetB()->GetTypeName());
+    EXPECT_EQ(random, effect->GetA());
+    EXPECT_EQ(nullptr, effect->GetI());
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestAnimationBaker, DISABLED_EvaluateBenchmark) {
+    const size_t count = 100000;
+    auto live = CreateSequence();
+    auto baked = AnimationBaker(100, 0.01).Bake(live);
+    auto length = live->GetTotalLength();
+
+    double liveSum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        live->SetMarker(static_cast<double>(i % 1000) * length / 1000);
+        liveSum += live->GetValue();
+    }
+    auto liveDuration = std::chrono::steady_clock::now() - start;
+
+    double bakedSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        baked->SetMarker(static_cast<double>(i % 1000) * length / 1000);
+        bakedSum += baked->GetValue();
+    }
+    auto bakedDuration = std::chrono::steady_clock::now() - start;
+
+    EXPECT_NEAR(liveSum / count, bakedSum / count, 0.01);
+    std::cout << "[ BENCHMARK] sequence live: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(liveDuration).count()
+              << " us, baked: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(bakedDuration).count()
+              << " us for " << count << " evaluations" << std::endl;
+}
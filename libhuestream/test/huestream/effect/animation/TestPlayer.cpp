@@ -1,3 +1,4 @@
+#include <huestream/common/time/FrameTime.h>
 #include <huestream/common/time/TimeManager.h>
 #include <huestream/common/time/TimeProviderProvider.h>
 #include <huestream/effect/animation/Player.h>
@@ -234,6 +235,29 @@ TEST_F(TestPlayer, PlayerIsStoppedAfterMixedCurveTypesAreArePlayedOnFiniteCurveP
     EXPECT_EQ(_player->IsStopped(), true);
 }
 
+TEST_F(TestPlayer, FrameTimeIsUsedWithinFrameScope) {
+    auto curve = CreateCurveFromValuesAndBind(
+            PointHelper::CreatePtr(NEW_PTR(Point, 0, 10), NEW_PTR(Point, 1000, 11), NEW_PTR(Point, 2000, 12),
+                                   NEW_PTR(Point, 3000, 13), NEW_PTR(Point, 4000, 14), NEW_PTR(Point, 5000, 15)));
+    _player->Start();
+
+    {
+        FrameTime::Scope frame(2000);
+        EXPECT_EQ(2000, FrameTime::Now());
+        _player->UpdateMarkers();
+        EXPECT_EQ(curve->GetValue(), 12);
+
+        {
+            FrameTime::Scope nestedFrame(2500);
+            EXPECT_EQ(2500, FrameTime::Now());
+        }
+        EXPECT_EQ(2000, FrameTime::Now());
+    }
+
+    EXPECT_EQ(0, FrameTime::Now());
+    EXPECT_EQ(AddMillisecondsAndReturnValue(curve, 3000), 13);
+}
+
 TEST_F(TestPlayer, CreatePlayer) {
     _player.reset();
     auto curve = CreateCurveFromPoints(PointHelper::CreatePtr(NEW_PTR(Point, 0, 10), NEW_PTR(Point, 1000, 11), NEW_PTR(Point, 2000, 12),
@@ -64,6 +64,24 @@ TEST_F(TestFrames, AfterLastFrame) {
     EXPECT_NEAR(AddMillisecondsAndReturnValue(&f, 100), 0.1, precision);
 }
 
+TEST_F(TestFrames, LastFrameAtEnd) {
+    auto f = FramesAnimation(10, 3);
+    f.SetLastFrameAtEnd(true);
+    f.Append(0.3);
+    f.Append(0.2);
+    f.Append(0.1);
+    EXPECT_DOUBLE_EQ(f.GetLengthMs(), 200);
+    EXPECT_NEAR(AddMillisecondsAndReturnValue(&f, 150), 0.15, precision);
+    EXPECT_NEAR(AddMillisecondsAndReturnValue(&f, 50), 0.1, precision);
+
+    JSONNode node;
+    f.Serialize(&node);
+    auto fd = FramesAnimation();
+    fd.Deserialize(&node);
+    EXPECT_TRUE(fd.GetLastFrameAtEnd());
+    EXPECT_DOUBLE_EQ(fd.GetLengthMs(), 200);
+}
+
 TEST_F(TestFrames, Empty) {
     auto f = FramesAnimation(10);
     EXPECT_NEAR(AddMillisecondsAndReturnValue(&f, 100), 0, precision);
@@ -4,6 +4,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "test/huestream/common/TestSerializeBase.h"
+#include <huestream/common/util/HueMath.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
 
 namespace huestream {
 
@@ -11,6 +16,18 @@ class TestTween : public testing::Test, public TestSerializeBase {
  public:
     virtual void SetUp() {}
     virtual void TearDown() {}
+
+    static double EvaluateHueMath(TweenType type, double t, double b, double e, double d) {
+        switch (type) {
+            case TweenType::Linear:
+                return HueMath::linearTween(t, b, e, d);
+            case TweenType::EaseInOutQuad:
+                return HueMath::easeInOutQuad(t, b, e, d);
+            case TweenType::EaseInOutSine:
+                return HueMath::easeInOutSine(t, b, e, d);
+        }
+        return 0;
+    }
 };
 
 TEST_F(TestTween, Serialize) {
@@ -90,6 +107,100 @@ TEST_F(TestTween, GetPositionFromValue) {
     ASSERT_EQ(c.GetPositionFromValue(10), 15);
     c.SetTweenType(TweenType::EaseInOutSine);
     ASSERT_EQ(c.GetPositionFromValue(0), 0);
-    ASSERT_EQ(c.GetPositionFromValue(10), 0);
+    ASSERT_NEAR(c.GetPositionFromValue(10), 15, 1e-9);
+    ASSERT_EQ(c.GetPositionFromValue(25), 0);
+}
+
+TEST_F(TestTween, GetPositionFromValueIsInverseOfValue) {
+    for (auto type : {TweenType::Linear, TweenType::EaseInOutQuad, TweenType::EaseInOutSine}) {
+        auto c = TweenAnimation(0.8, 0.2, 60000, type);
+        for (double position = 0; position <= 60000; position += 1234.5) {
+            double value = 0;
+            c.UpdateValue(&value, position);
+            EXPECT_NEAR(position, c.GetPositionFromValue(value), 1e-6);
+        }
+    }
 }
+
+TEST_F(TestTween, KernelMatchesHueMath) {
+    std::vector<double> positions;
+    for (int t = -10; t <= 1100; t += 5) {
+        positions.push_back(t + 0.25);
+    }
+    std::vector<double> values(positions.size());
+
+    for (auto type : {TweenType::Linear, TweenType::EaseInOutQuad, TweenType::EaseInOutSine}) {
+        auto kernel = TweenKernel(type, 0.2, -0.7, 1000);
+        kernel.Evaluate(positions.data(), values.data(), positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            auto expected = EvaluateHueMath(type, positions[i], 0.2, -0.7, 1000);
+            EXPECT_NEAR(expected, kernel.Evaluate(positions[i]), 1e-12);
+            EXPECT_EQ(kernel.Evaluate(positions[i]), values[i]);
+        }
+        EXPECT_EQ(-0.7, kernel.Evaluate(1000.5));
+    }
+}
+
+TEST_F(TestTween, KernelFollowsChanges) {
+    auto c = TweenAnimation(0, 1, 1000, TweenType::Linear);
+    EXPECT_DOUBLE_EQ(0.5, c.GetKernel().Evaluate(500));
+
+    c.SetEnd(2);
+    EXPECT_DOUBLE_EQ(1, c.GetKernel().Evaluate(500));
+
+    c.SetTweenType(TweenType::EaseInOutQuad);
+    EXPECT_DOUBLE_EQ(0.25, c.GetKernel().Evaluate(250));
+}
+
+TEST_F(TestTween, UpdateValueWithoutBeginStartsFromCurrentValue) {
+    auto c = TweenAnimation(1, 1000, TweenType::Linear);
+    double value = 0.5;
+    c.UpdateValue(&value, 0);
+    EXPECT_DOUBLE_EQ(0.5, value);
+    c.UpdateValue(&value, 500);
+    EXPECT_DOUBLE_EQ(0.75, value);
+    c.UpdateValue(&value, 2000);
+    EXPECT_DOUBLE_EQ(1, value);
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestTween, DISABLED_EvaluateBenchmark) {
+    const size_t count = 100000;
+    std::vector<double> positions(count);
+    for (size_t i = 0; i < count; ++i) {
+        positions[i] = static_cast<double>(i % 1200);
+    }
+    std::vector<double> values(count);
+
+    for (auto type : {TweenType::Linear, TweenType::EaseInOutQuad, TweenType::EaseInOutSine}) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = EvaluateHueMath(type, positions[i], 0.1, 0.9, 1000);
+        }
+        auto hueMathDuration = std::chrono::steady_clock::now() - start;
+        auto checksum = values[count / 3];
+
+        auto kernel = TweenKernel(type, 0.1, 0.9, 1000);
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = kernel.Evaluate(positions[i]);
+        }
+        auto kernelDuration = std::chrono::steady_clock::now() - start;
+        EXPECT_NEAR(checksum, values[count / 3], 1e-12);
+
+        start = std::chrono::steady_clock::now();
+        kernel.Evaluate(positions.data(), values.data(), count);
+        auto batchDuration = std::chrono::steady_clock::now() - start;
+        EXPECT_NEAR(checksum, values[count / 3], 1e-12);
+
+        std::cout << "[ BENCHMARK] " << TweenTypeHelper::ToString(type) << " HueMath: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(hueMathDuration).count()
+                  << " us, kernel: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(kernelDuration).count()
+                  << " us, batch kernel: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(batchDuration).count()
+                  << " us for " << count << " values" << std::endl;
+    }
+}
+
 }  // namespace huestream
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "test/huestream/common/TestSerializeBase.h"
+#include <cmath>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -53,6 +55,159 @@ namespace huestream { ;
         ASSERT_DOUBLE_EQ(c.GetInterpolated(15)->GetY(), 0.6);
     }
 
+    TEST_F(TestCurveData, InterpolateLargeCurveInAnyOrder) {
+        auto c = CurveData();
+        for (int i = 0; i < 10000; ++i) {
+            c.AppendPoint(NEW_PTR(Point, i * 10, i % 2));
+        }
+
+        for (int x = 0; x < 99990; x += 7) {
+            ASSERT_DOUBLE_EQ((x % 20) < 10 ? (x % 10) / 10.0 : 1 - (x % 10) / 10.0, c.GetInterpolatedValue(x));
+        }
+        for (int x = 99985; x > 0; x -= 4001) {
+            ASSERT_DOUBLE_EQ((x % 20) < 10 ? (x % 10) / 10.0 : 1 - (x % 10) / 10.0, c.GetInterpolatedValue(x));
+            ASSERT_DOUBLE_EQ((x % 20) < 10 ? 0 : 1, c.GetStepValue(x));
+        }
+    }
+
+    TEST_F(TestCurveData, CopyIsIndependentOfOriginal) {
+        auto c = CurveData(CreateTestPoints());
+        auto copy = c;
+        ASSERT_EQ(c.GetX(), copy.GetX());
+
+        copy.AppendPoint(NEW_PTR(Point, 11, 12));
+        EXPECT_NE(c.GetX(), copy.GetX());
+        EXPECT_EQ(5, c.GetPointCount());
+        EXPECT_EQ(5, c.GetPoints()->size());
+        EXPECT_EQ(6, copy.GetPointCount());
+        EXPECT_EQ(6, copy.GetPoints()->size());
+        EXPECT_DOUBLE_EQ(11, copy.GetInterpolatedValue(10));
+    }
+
+    TEST_F(TestCurveData, GetPointsFollowsChanges) {
+        auto c = CurveData(CreateTestPoints());
+        EXPECT_EQ(5, c.GetPoints()->size());
+
+        c.Append(c);
+        auto points = c.GetPoints();
+        ASSERT_EQ(10, points->size());
+        EXPECT_EQ(9, (*points)[4]->GetX());
+        EXPECT_EQ(10, (*points)[5]->GetX());
+        EXPECT_EQ(2, (*points)[5]->GetY());
+        EXPECT_EQ(18, (*points)[9]->GetX());
+    }
+
+    TEST_F(TestCurveData, GetPointsIsBuiltOnceUntilChanged) {
+        auto c = CurveData(CreateTestPoints());
+        auto points = c.GetPoints();
+        EXPECT_EQ(points, c.GetPoints());
+
+        auto copy = c;
+        EXPECT_EQ(points, copy.GetPoints());
+
+        copy.AppendPoint(NEW_PTR(Point, 11, 12));
+        EXPECT_EQ(points, c.GetPoints());
+        EXPECT_NE(points, copy.GetPoints());
+        EXPECT_EQ(6, copy.GetPoints()->size());
+
+        c.SetPoints(copy.GetPoints());
+        EXPECT_NE(points, c.GetPoints());
+        EXPECT_EQ(6, c.GetPoints()->size());
+    }
+
+    TEST_F(TestCurveData, CopiesSharingPointsGetPointsConcurrently) {
+        auto c = CurveData();
+        for (int i = 0; i < 1000; ++i) {
+            c.AppendPoint(NEW_PTR(Point, i * 10, i / 1000.0));
+        }
+
+        std::vector<CurveData> copies(4, c);
+        std::vector<PointListPtr> points(copies.size());
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < copies.size(); ++t) {
+            threads.emplace_back([&copies, &points, t]() {
+                points[t] = copies[t].GetPoints();
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (size_t t = 0; t < copies.size(); ++t) {
+            EXPECT_EQ(points[0], points[t]);
+        }
+        EXPECT_EQ(1000, points[0]->size());
+        EXPECT_EQ(points[0], c.GetPoints());
+    }
+
+    TEST_F(TestCurveData, GetPositionFromValue) {
+        auto c = CurveData();
+        c.AppendPoint(NEW_PTR(Point, 0, 0.5));
+        c.AppendPoint(NEW_PTR(Point, 100, 0.1));
+        c.AppendPoint(NEW_PTR(Point, 200, 0.9));
+        c.AppendPoint(NEW_PTR(Point, 300, 0.3));
+        c.AppendPoint(NEW_PTR(Point, 400, 0.3));
+
+        double position = -1;
+        ASSERT_TRUE(c.GetPositionFromValue(0.5, &position));
+        EXPECT_DOUBLE_EQ(0, position);
+        ASSERT_TRUE(c.GetPositionFromValue(0.3, &position));
+        EXPECT_DOUBLE_EQ(50, position);
+        ASSERT_TRUE(c.GetPositionFromValue(0.9, &position));
+        EXPECT_DOUBLE_EQ(200, position);
+        ASSERT_TRUE(c.GetPositionFromValue(0.7, &position));
+        EXPECT_DOUBLE_EQ(175, position);
+        EXPECT_FALSE(c.GetPositionFromValue(0.95, &position));
+        EXPECT_FALSE(c.GetPositionFromValue(0.05, &position));
+
+        c.AppendPoint(NEW_PTR(Point, 500, 1.1));
+        ASSERT_TRUE(c.GetPositionFromValue(0.95, &position));
+        EXPECT_DOUBLE_EQ(481.25, position);
+    }
+
+    TEST_F(TestCurveData, GetPositionFromValueOfLargeCurve) {
+        auto c = CurveData();
+        for (int i = 0; i <= 10000; ++i) {
+            c.AppendPoint(NEW_PTR(Point, i * 10, i / 10000.0));
+        }
+
+        double position = -1;
+        for (int i = 0; i < 10000; i += 37) {
+            ASSERT_TRUE(c.GetPositionFromValue(i / 10000.0 + 0.00005, &position));
+            EXPECT_NEAR(i * 10 + 5, position, 1e-6);
+        }
+    }
+
+    TEST_F(TestCurveData, CopiesSharingPointsLookUpPositionsConcurrently) {
+        auto c = CurveData();
+        for (int i = 0; i <= 10000; ++i) {
+            c.AppendPoint(NEW_PTR(Point, i * 10, i / 10000.0));
+        }
+
+        std::vector<CurveData> copies(4, c);
+        std::vector<int> failures(copies.size());
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < copies.size(); ++t) {
+            threads.emplace_back([&copies, &failures, t]() {
+                double position = -1;
+                for (int i = 0; i < 10000; i += 37) {
+                    if (!copies[t].GetPositionFromValue(i / 10000.0 + 0.00005, &position) ||
+                        std::abs(i * 10 + 5 - position) > 1e-6) {
+                        failures[t]++;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (size_t t = 0; t < copies.size(); ++t) {
+            EXPECT_EQ(c.GetX(), copies[t].GetX());
+            EXPECT_EQ(0, failures[t]);
+        }
+    }
+
     TEST_F(TestCurveData, Serialize) {
         auto c = CurveData(CreateTestPoints());
 
@@ -2,6 +2,7 @@
 #include <huestream/effect/effects/base/Effect.h>
 #include <huestream/effect/animation/animations/ConstantAnimation.h>
 #include <huestream/common/data/Area.h>
+#include <huestream/common/data/CuboidArea.h>
 #include "gtest/gtest.h"
 #include "test/huestream/common/TestSerializeBase.h"
 #include "test/huestream/_mock/MockTimeManager.h"
@@ -29,6 +30,41 @@ namespace huestream {
         std::shared_ptr<MockTimeManager> _timeProvider;
     };
 
+    TEST_F(TestAreaEffect, GetColorsMatchesGetColor) {
+        auto areaEffect = std::make_shared<AreaEffect>("Some Effect", 0);
+        areaEffect->SetColorAnimation(std::make_shared<ConstantAnimation>(0.1), std::make_shared<ConstantAnimation>(0.2),
+                                      std::make_shared<ConstantAnimation>(0.4));
+        areaEffect->SetFixedOpacity(0.7);
+        areaEffect->AddArea(Area::FrontLeftQuarter);
+        areaEffect->AddArea(Area::BackRightQuarter);
+
+        auto lights = std::make_shared<LightList>();
+        lights->push_back(std::make_shared<Light>("1", Location(-0.5, 0.5)));
+        lights->push_back(std::make_shared<Light>("2", Location(0.5, 0.5)));
+        lights->push_back(std::make_shared<Light>("3", Location(0.5, -0.5)));
+        lights->push_back(std::make_shared<Light>("4", Location(-0.5, -0.5)));
+        LightBuffer buffer;
+        buffer.Update(lights);
+
+        double r[4], g[4], b[4], a[4];
+        areaEffect->GetColors(buffer, r, g, b, a);
+        for (size_t i = 0; i < lights->size(); ++i) {
+            assert_colors_equal(areaEffect->GetColor(lights->at(i)), Color(r[i], g[i], b[i], a[i]));
+        }
+        EXPECT_DOUBLE_EQ(0.7, a[0]);
+        EXPECT_DOUBLE_EQ(0, a[1]);
+        EXPECT_DOUBLE_EQ(0.7, a[2]);
+
+        areaEffect->SetArea(Area(-1, 1, 0, 0, "InvertedFrontLeft", true));
+        areaEffect->AddArea(CuboidArea(Location(0, 1, 1), Location(1, 0, 0), "FrontRightTop"));
+        areaEffect->GetColors(buffer, r, g, b, a);
+        for (size_t i = 0; i < lights->size(); ++i) {
+            assert_colors_equal(areaEffect->GetColor(lights->at(i)), Color(r[i], g[i], b[i], a[i]));
+        }
+        EXPECT_DOUBLE_EQ(0, a[0]);
+        EXPECT_DOUBLE_EQ(0.7, a[1]);
+    }
+
     TEST_F(TestAreaEffect, GetColor) {
         auto areaEffect = std::make_shared<AreaEffect>("Some Effect", 0);
         areaEffect->SetColorAnimation(std::make_shared<ConstantAnimation>(0.1), std::make_shared<ConstantAnimation>(0.2),
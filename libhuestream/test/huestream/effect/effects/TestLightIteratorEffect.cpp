@@ -1,5 +1,8 @@
 #include <huestream/effect/effects/base/Effect.h>
 #include <huestream/effect/animation/animations/ConstantAnimation.h>
+#include <huestream/effect/animation/animations/CurveAnimation.h>
+#include <huestream/effect/animation/animations/SequenceAnimation.h>
+#include <huestream/effect/animation/data/PointHelper.h>
 #include "gtest/gtest.h"
 #include "test/huestream/common/TestSerializeBase.h"
 #include "huestream/effect/Mixer.h"
@@ -183,6 +186,55 @@ namespace huestream {
         
     }
 
+    TEST_F(TestLightIteratorEffect, StatelessAnimationsAreSharedByLights) {
+        std::vector<LightPtr> lights;
+        for (int i = 0; i < 3; ++i) {
+            _group->AddLight(std::to_string(i), -0.5 + 0.5 * i, 0.5);
+            lights.push_back(_group->GetLights()->back());
+        }
+
+        auto iterEffect = std::make_shared<LightIteratorEffect>("Some Effect", 0);
+        iterEffect->SetPlayer(_player);
+        auto ramp = std::make_shared<CurveAnimation>(PointHelper::CreatePtr(std::make_shared<Point>(0, 0),
+                                                                            std::make_shared<Point>(1000, 1)));
+        auto fromCurrent = std::make_shared<TweenAnimation>(1, 1000, TweenType::Linear);
+        auto zero = std::make_shared<ConstantAnimation>(0, 1000);
+        iterEffect->SetColorAnimation(ramp, zero, fromCurrent);
+        iterEffect->SetOpacityAnimation(ramp);
+        iterEffect->SetOffset(500);
+        iterEffect->SetMode(IterationModeCycle);
+        iterEffect->UpdateGroup(_group);
+
+        auto animations = iterEffect->GetAnimations();
+        ASSERT_EQ(12, animations->size());
+        for (size_t i = 0; i < animations->size(); ++i) {
+            auto sequences = std::static_pointer_cast<SequenceAnimation>(animations->at(i))->GetSequences();
+            auto shared = std::find(sequences->begin(), sequences->end(), ramp) != sequences->end() ||
+                          std::find(sequences->begin(), sequences->end(), zero) != sequences->end();
+            auto cloned = std::find(sequences->begin(), sequences->end(), fromCurrent) == sequences->end();
+            EXPECT_TRUE(i % 4 == 2 ? cloned : shared);
+        }
+
+        iterEffect->Enable();
+        _tp->AddMilliseconds(700);
+        iterEffect->Render();
+        EXPECT_DOUBLE_EQ(0.7, iterEffect->GetColor(lights[0]).GetR());
+        EXPECT_DOUBLE_EQ(0.2, iterEffect->GetColor(lights[1]).GetR());
+        EXPECT_DOUBLE_EQ(0, iterEffect->GetColor(lights[2]).GetR());
+
+        // a cycle is the curve length of 1001 ms plus the offsets of the other lights
+        _tp->AddMilliseconds(2001);
+        iterEffect->Render();
+        EXPECT_DOUBLE_EQ(0.7, iterEffect->GetColor(lights[0]).GetR());
+        EXPECT_DOUBLE_EQ(0.2, iterEffect->GetColor(lights[1]).GetR());
+        EXPECT_DOUBLE_EQ(0, iterEffect->GetColor(lights[2]).GetR());
+
+        _tp->AddMilliseconds(1000);
+        iterEffect->Render();
+        EXPECT_DOUBLE_EQ(0, iterEffect->GetColor(lights[0]).GetR());
+        EXPECT_DOUBLE_EQ(0.7, iterEffect->GetColor(lights[2]).GetR());
+    }
+
     TEST_F(TestLightIteratorEffect, Serialize) {
         auto c = std::make_shared<LightIteratorEffect>("Some Effect", 2);
 
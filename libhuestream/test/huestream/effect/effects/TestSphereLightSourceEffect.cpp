@@ -45,6 +45,31 @@ namespace huestream {
         assert_colors_matching(_effect);
     }
 
+    TEST_F(TestSphereLightSourceEffect, GetColorsMatchesGetColor) {
+        auto lights = std::make_shared<LightList>();
+        lights->push_back(_lightInRadius);
+        lights->push_back(_lightOutRadius);
+        lights->push_back(std::make_shared<Light>("3", Location(-0.7, 0.6, 0.9)));
+        lights->push_back(std::make_shared<Light>("4", Location(-0.8, 0.8, -0.5)));
+        LightBuffer buffer;
+        buffer.Update(lights);
+
+        for (auto opacityBoundToIntensity : {false, true}) {
+            _effect->SetOpacityBoundToIntensity(opacityBoundToIntensity);
+            _effect->SetIntensityAnimation(std::make_shared<ConstantAnimation>(0.5));
+
+            double r[4], g[4], b[4], a[4];
+            _effect->GetColors(buffer, r, g, b, a);
+            for (size_t i = 0; i < lights->size(); ++i) {
+                auto color = _effect->GetColor(lights->at(i));
+                EXPECT_DOUBLE_EQ(color.GetR(), r[i]);
+                EXPECT_DOUBLE_EQ(color.GetG(), g[i]);
+                EXPECT_DOUBLE_EQ(color.GetB(), b[i]);
+                EXPECT_DOUBLE_EQ(color.GetAlpha(), a[i]);
+            }
+        }
+    }
+
     TEST_F(TestSphereLightSourceEffect, Serialize) {
         JSONNode node;
         _effect->Serialize(&node);
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/ConnectBackoff.h>
+#include "gtest/gtest.h"
+
+namespace huestream {
+
+    class TestConnectBackoff : public testing::Test {
+    protected:
+        void Connect(int attempts) {
+            _backoff.Start();
+            for (int i = 0; i < attempts; ++i) {
+                _backoff.GetNextDelay();
+            }
+            _backoff.Succeeded();
+        }
+
+        ConnectBackoff _backoff{50, 1000};
+    };
+
+    TEST_F(TestConnectBackoff, DoublesDelayUpToMaximum) {
+        _backoff.Start();
+        EXPECT_EQ(50, _backoff.GetNextDelay());
+        EXPECT_EQ(100, _backoff.GetNextDelay());
+        EXPECT_EQ(200, _backoff.GetNextDelay());
+        EXPECT_EQ(400, _backoff.GetNextDelay());
+        EXPECT_EQ(800, _backoff.GetNextDelay());
+        EXPECT_EQ(1000, _backoff.GetNextDelay());
+        EXPECT_EQ(1000, _backoff.GetNextDelay());
+    }
+
+    TEST_F(TestConnectBackoff, StartsWithDelayWhichSucceededBefore) {
+        Connect(3);
+        EXPECT_EQ(200, _backoff.GetStartDelay());
+
+        _backoff.Start();
+        EXPECT_EQ(200, _backoff.GetNextDelay());
+        EXPECT_EQ(400, _backoff.GetNextDelay());
+    }
+
+    TEST_F(TestConnectBackoff, ShrinksAfterFirstAttemptSucceeded) {
+        Connect(4);
+        EXPECT_EQ(400, _backoff.GetStartDelay());
+        Connect(1);
+        EXPECT_EQ(200, _backoff.GetStartDelay());
+        Connect(1);
+        Connect(1);
+        Connect(1);
+        EXPECT_EQ(50, _backoff.GetStartDelay());
+    }
+
+    TEST_F(TestConnectBackoff, FailedSequenceKeepsStartDelay) {
+        Connect(2);
+        _backoff.Start();
+        for (int i = 0; i < 5; ++i) {
+            _backoff.GetNextDelay();
+        }
+        EXPECT_EQ(100, _backoff.GetStartDelay());
+    }
+
+}  // namespace huestream
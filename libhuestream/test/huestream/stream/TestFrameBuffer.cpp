@@ -0,0 +1,81 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/FrameBuffer.h>
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace huestream {
+
+    class TestFrameBuffer : public testing::Test {
+    protected:
+        void Publish(uint8_t value) {
+            _buffer.GetWriteFrame().assign(1, value);
+            _buffer.Publish();
+        }
+
+        FrameBuffer _buffer;
+    };
+
+    TEST_F(TestFrameBuffer, NothingToConsumeBeforePublish) {
+        EXPECT_FALSE(_buffer.Consume());
+        EXPECT_EQ(0, _buffer.GetDroppedFrameCount());
+    }
+
+    TEST_F(TestFrameBuffer, ConsumesPublishedFrameOnce) {
+        Publish(1);
+
+        ASSERT_TRUE(_buffer.Consume());
+        ASSERT_EQ(std::vector<uint8_t>({1}), _buffer.GetReadFrame());
+        EXPECT_FALSE(_buffer.Consume());
+        EXPECT_EQ(std::vector<uint8_t>({1}), _buffer.GetReadFrame());
+    }
+
+    TEST_F(TestFrameBuffer, DropsFramesWhichAreNotConsumed) {
+        Publish(1);
+        Publish(2);
+        Publish(3);
+
+        ASSERT_TRUE(_buffer.Consume());
+        EXPECT_EQ(std::vector<uint8_t>({3}), _buffer.GetReadFrame());
+        EXPECT_EQ(2, _buffer.GetDroppedFrameCount());
+
+        Publish(4);
+        ASSERT_TRUE(_buffer.Consume());
+        EXPECT_EQ(std::vector<uint8_t>({4}), _buffer.GetReadFrame());
+        EXPECT_EQ(2, _buffer.GetDroppedFrameCount());
+    }
+
+    TEST_F(TestFrameBuffer, ConsumerSeesIncreasingFramesWhilePublishing) {
+        const int frames = 100000;
+
+        std::thread producer([this, frames]() {
+            for (int i = 1; i <= frames; ++i) {
+                auto& frame = _buffer.GetWriteFrame();
+                frame.assign(reinterpret_cast<const uint8_t*>(&i), reinterpret_cast<const uint8_t*>(&i) + sizeof(i));
+                _buffer.Publish();
+            }
+        });
+
+        int last = 0;
+        int consumed = 0;
+        while (last < frames) {
+            if (!_buffer.Consume()) {
+                continue;
+            }
+            const auto& frame = _buffer.GetReadFrame();
+            ASSERT_EQ(sizeof(int), frame.size());
+            auto value = *reinterpret_cast<const int*>(frame.data());
+            ASSERT_GT(value, last);
+            last = value;
+            consumed++;
+        }
+        producer.join();
+
+        EXPECT_EQ(frames, consumed + _buffer.GetDroppedFrameCount());
+    }
+}
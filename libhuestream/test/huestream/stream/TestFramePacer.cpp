@@ -0,0 +1,92 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/FramePacer.h>
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+
+namespace huestream {
+
+    class TestFramePacer : public testing::Test {
+    protected:
+        FramePacer _pacer;
+    };
+
+    TEST_F(TestFramePacer, PeriodHasNanosecondResolution) {
+        _pacer.Start(60);
+        EXPECT_EQ(16666666, _pacer.GetPeriod().count());
+    }
+
+    TEST_F(TestFramePacer, NoStatisticsBeforeFrames) {
+        _pacer.Start(50);
+        auto statistics = _pacer.GetStatistics();
+        EXPECT_EQ(0, statistics.frameCount);
+        EXPECT_EQ(0, statistics.lateFrameCount);
+        EXPECT_EQ(0, statistics.meanFrameTimeMs);
+        EXPECT_EQ(0, statistics.p99FrameTimeMs);
+    }
+
+    TEST_F(TestFramePacer, WaitsOnAbsoluteDeadlines) {
+        const int frames = 20;
+        _pacer.Start(200, std::chrono::microseconds(200));
+
+        auto start = FramePacer::Clock::now();
+        for (int i = 0; i < frames; ++i) {
+            _pacer.MarkFrame();
+            _pacer.WaitForNextFrame();
+        }
+        auto duration = FramePacer::Clock::now() - start;
+
+        // no drift accumulates over the frames
+        EXPECT_GE(duration, std::chrono::milliseconds(5 * (frames - 1)));
+        EXPECT_LT(duration, std::chrono::milliseconds(5 * frames + 20));
+
+        auto statistics = _pacer.GetStatistics();
+        EXPECT_EQ(frames, statistics.frameCount);
+        EXPECT_NEAR(5.0, statistics.meanFrameTimeMs, 1.0);
+        EXPECT_GE(statistics.p99FrameTimeMs, statistics.meanFrameTimeMs);
+    }
+
+    TEST_F(TestFramePacer, RestartFromAnotherThreadAppliesToNextFrame) {
+        _pacer.Start(10);
+
+        auto start = FramePacer::Clock::now();
+        std::thread waiter([this]() {
+            _pacer.WaitForNextFrame();
+            _pacer.WaitForNextFrame();
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        _pacer.Start(1000);
+        waiter.join();
+        auto duration = FramePacer::Clock::now() - start;
+
+        // the frame already waited for keeps its deadline, the one after it follows the new schedule
+        EXPECT_EQ(1000000, _pacer.GetPeriod().count());
+        EXPECT_GE(duration, std::chrono::milliseconds(100));
+        EXPECT_LT(duration, std::chrono::milliseconds(150));
+    }
+
+    TEST_F(TestFramePacer, RestartsScheduleWhenFallingBehind) {
+        _pacer.Start(100);
+        _pacer.MarkFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(55));
+
+        auto start = FramePacer::Clock::now();
+        _pacer.WaitForNextFrame();
+        _pacer.MarkFrame();
+        _pacer.WaitForNextFrame();
+        _pacer.MarkFrame();
+        auto duration = FramePacer::Clock::now() - start;
+
+        // the late frame starts right away, no burst of missed frames follows
+        EXPECT_GE(duration, std::chrono::milliseconds(10));
+
+        auto statistics = _pacer.GetStatistics();
+        EXPECT_EQ(3, statistics.frameCount);
+        EXPECT_EQ(1, statistics.lateFrameCount);
+    }
+}
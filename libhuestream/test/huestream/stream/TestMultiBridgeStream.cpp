@@ -0,0 +1,155 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include <huestream/stream/MultiBridgeStream.h>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "test/huestream/_mock/MockStream.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::NiceMock;
+
+namespace huestream {
+
+    class TestMultiBridgeStream : public testing::Test {
+    protected:
+        void SetUp() override {
+            _streamSettings = std::make_shared<StreamSettings>();
+            _streamSettings->SetUpdateFrequency(200);
+            _multiStream = std::make_shared<MultiBridgeStream>(_streamSettings);
+
+            for (int i = 0; i < 2; ++i) {
+                _bridges.push_back(CreateBridge("BRIDGE" + std::to_string(i), std::to_string(i * 10)));
+                _streams.push_back(std::make_shared<NiceMock<MockStream>>());
+                _multiStream->AddBridge(_bridges[i], _streams[i]);
+            }
+        }
+
+        void TearDown() override {
+            for (const auto& stream : _streams) {
+                EXPECT_CALL(*stream, Stop()).Times(_multiStream->IsStreaming() ? 1 : 0);
+            }
+            _multiStream->Stop();
+        }
+
+        BridgePtr CreateBridge(const std::string& id, const std::string& lightId) {
+            auto group = std::make_shared<Group>();
+            group->SetId("1");
+            group->AddLight(lightId, 0.1, 0.1, 0.1, "1", "LTC001");
+            auto groupList = std::make_shared<GroupList>();
+            groupList->push_back(group);
+            auto bridge = std::make_shared<Bridge>(std::make_shared<BridgeSettings>());
+            bridge->SetGroups(groupList);
+            bridge->SetSelectedGroup("1");
+            bridge->SetId(id);
+            return bridge;
+        }
+
+        void ExpectStart() {
+            for (size_t i = 0; i < _streams.size(); ++i) {
+                EXPECT_CALL(*_streams[i], Start(_bridges[i])).WillOnce(Return(true));
+            }
+        }
+
+        StreamSettingsPtr _streamSettings;
+        MultiBridgeStreamPtr _multiStream;
+        std::vector<BridgePtr> _bridges;
+        std::vector<std::shared_ptr<MockStream>> _streams;
+    };
+
+    TEST_F(TestMultiBridgeStream, GroupContainsLightsOfAllBridges) {
+        auto lights = _multiStream->GetGroup()->GetLights();
+        ASSERT_EQ(2, lights->size());
+        EXPECT_EQ(_bridges[0]->GetGroup()->GetLights()->at(0), lights->at(0));
+        EXPECT_EQ(_bridges[1]->GetGroup()->GetLights()->at(0), lights->at(1));
+    }
+
+    TEST_F(TestMultiBridgeStream, RenderOnceAndSendToAllBridges) {
+        ExpectStart();
+        ASSERT_TRUE(_multiStream->Start());
+        ASSERT_TRUE(_multiStream->IsStreaming());
+
+        auto renderCount = 0;
+        _multiStream->SetRenderCallback([&renderCount]() { renderCount++; });
+        for (const auto& stream : _streams) {
+            EXPECT_CALL(*stream, RenderSingleFrame()).Times(2);
+        }
+
+        _multiStream->RenderSingleFrame();
+        _multiStream->RenderSingleFrame();
+        EXPECT_EQ(2, renderCount);
+    }
+
+    TEST_F(TestMultiBridgeStream, FailingBridgeStopsStartedBridges) {
+        EXPECT_CALL(*_streams[0], Start(_bridges[0])).WillOnce(Return(true));
+        EXPECT_CALL(*_streams[1], Start(_bridges[1])).WillOnce(Return(false));
+        EXPECT_CALL(*_streams[0], Stop()).Times(1);
+
+        ASSERT_FALSE(_multiStream->Start());
+        ASSERT_FALSE(_multiStream->IsStreaming());
+
+        EXPECT_CALL(*_streams[0], RenderSingleFrame()).Times(0);
+        _multiStream->RenderSingleFrame();
+    }
+
+    TEST_F(TestMultiBridgeStream, BridgesAreStartedConcurrently) {
+        std::mutex mutex;
+        std::condition_variable condition;
+        auto starting = 0;
+        auto startBoth = [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            starting++;
+            condition.notify_all();
+            return condition.wait_for(lock, std::chrono::seconds(5), [&]() { return starting == 2; });
+        };
+        for (size_t i = 0; i < _streams.size(); ++i) {
+            EXPECT_CALL(*_streams[i], Start(_bridges[i])).WillOnce(testing::Invoke([&](BridgePtr) { return startBoth(); }));
+        }
+
+        ASSERT_TRUE(_multiStream->Start());
+    }
+
+    TEST_F(TestMultiBridgeStream, BridgeStreamSettingsUseSendThread) {
+        auto settings = _multiStream->CreateBridgeStreamSettings();
+        EXPECT_TRUE(settings->UseSendThread());
+        EXPECT_EQ(200, settings->GetUpdateFrequency());
+        EXPECT_FALSE(_streamSettings->UseSendThread());
+    }
+
+    TEST_F(TestMultiBridgeStream, StartWithRenderThread) {
+        ExpectStart();
+        for (const auto& stream : _streams) {
+            EXPECT_CALL(*stream, RenderSingleFrame()).Times(testing::AtLeast(5));
+        }
+
+        ASSERT_TRUE(_multiStream->StartWithRenderThread());
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    TEST_F(TestMultiBridgeStream, StatisticsPerBridge) {
+        FrameStatistics frameStatistics = {};
+        frameStatistics.sendCount = 7;
+        frameStatistics.sendFailureCount = 1;
+        EXPECT_CALL(*_streams[0], IsStreaming()).WillOnce(Return(true));
+        EXPECT_CALL(*_streams[1], IsStreaming()).WillOnce(Return(false));
+        EXPECT_CALL(*_streams[0], GetFrameStatistics()).WillOnce(Return(frameStatistics));
+
+        auto statistics = _multiStream->GetStatistics();
+        ASSERT_EQ(2, statistics.size());
+        EXPECT_EQ("BRIDGE0", statistics[0].bridgeId);
+        EXPECT_TRUE(statistics[0].isStreaming);
+        EXPECT_EQ(7, statistics[0].frameStatistics.sendCount);
+        EXPECT_EQ(1, statistics[0].frameStatistics.sendFailureCount);
+        EXPECT_EQ("BRIDGE1", statistics[1].bridgeId);
+        EXPECT_FALSE(statistics[1].isStreaming);
+    }
+}
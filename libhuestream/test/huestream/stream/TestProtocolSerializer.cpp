@@ -7,6 +7,11 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
 namespace huestream {
 
     class TestProtocolSerializer : public testing::Test {
@@ -80,6 +85,184 @@ namespace huestream {
         ASSERT_THAT(payload, testing::ElementsAreArray(expect));
     }
 
+    TEST_F(TestProtocolSerializer, SerializeReusesBufferAndUpdatesPayload) {
+        ProtocolSerializer serializer(_options);
 
-}
+        auto first = serializer.Serialize(1);
+        _options->group->GetLights()->at(0)->SetColor(Color(0.0, 1.0, 0.0));
+        const auto& second = serializer.Serialize(2);
+
+        ASSERT_EQ(first.size(), second.size());
+        EXPECT_EQ(1, first[11]);
+        EXPECT_EQ(2, second[11]);
+        EXPECT_EQ(0xFF, first[19]);
+        EXPECT_EQ(0x00, second[19]);
+        EXPECT_EQ(0xFF, second[21]);
+        EXPECT_EQ(second.data(), serializer.Serialize(3).data());
+    }
+
+    TEST_F(TestProtocolSerializer, PayloadChangedOnlyWhenColorsChange) {
+        ProtocolSerializer serializer(_options);
+
+        serializer.Serialize(0);
+        EXPECT_TRUE(serializer.IsPayloadChanged());
+        serializer.Serialize(1);
+        EXPECT_FALSE(serializer.IsPayloadChanged());
+
+        _options->group->GetLights()->at(1)->SetColor(Color(0.0, 0.0, 1.0));
+        serializer.Serialize(2);
+        EXPECT_TRUE(serializer.IsPayloadChanged());
+        serializer.Serialize(3);
+        EXPECT_FALSE(serializer.IsPayloadChanged());
+
+        serializer.Invalidate();
+        serializer.Serialize(4);
+        EXPECT_TRUE(serializer.IsPayloadChanged());
+    }
+
+    TEST_F(TestProtocolSerializer, SerializeRebuildsOnGroupChange) {
+        ProtocolSerializer serializer(_options);
+        EXPECT_EQ(16 + 2 * 9, serializer.Serialize(0).size());
+
+        auto group = std::make_shared<Group>();
+        group->AddLight("3", 0, 0);
+        group->AddLight("4", 0, 0);
+        group->AddLight("105", 0, 0);
+        _options->group = group;
+        serializer.Invalidate();
+
+        const auto& payload = serializer.Serialize(0);
+        ASSERT_EQ(16 + 3 * 9, payload.size());
+        EXPECT_EQ(0, payload[16]);
+        EXPECT_EQ(3, payload[18]);
+        EXPECT_EQ(4, payload[27]);
+        EXPECT_EQ(1, payload[34]);
+        EXPECT_EQ(5, payload[36]);
+    }
+
+    TEST_F(TestProtocolSerializer, SerializeClipV2) {
+        _options->useClipV2 = true;
+        _options->group->SetId("1a8d99cc-967b-44f2-9202-43f976c0fa6b");
+
+        auto payload = ProtocolSerializer(_options).Serialize(7);
+
+        ASSERT_EQ(16 + 36 + 2 * 7, payload.size());
+        EXPECT_EQ(2, payload[9]);
+        EXPECT_EQ(7, payload[11]);
+        EXPECT_EQ(_options->group->GetId(), std::string(payload.begin() + 16, payload.begin() + 52));
+        EXPECT_EQ(1, payload[52]);
+        EXPECT_EQ(0xFF, payload[53]);
+        EXPECT_EQ(2, payload[59]);
+        EXPECT_EQ(0xFF, payload[65]);
+    }
+
+    TEST_F(TestProtocolSerializer, SerializeXYBrightness) {
+        _options->colorSpace = COLORSPACE_XYBRI;
+        _options->group->GetLights()->at(1)->SetColor(Color(0.0, 0.0, 0.0));
+
+        auto payload = ProtocolSerializer(_options).Serialize(1);
+        ASSERT_EQ(16 + 2 * 9, payload.size());
+        EXPECT_EQ(COLORSPACE_XYBRI, payload[14]);
+
+        double Y, x, y;
+        Color(1.0, 0.0, 0.02).GetYxy(Y, x, y);
+        auto readUint16 = [&payload](size_t offset) { return (payload[offset] << 8) | payload[offset + 1]; };
+        EXPECT_NEAR(static_cast<int>(x * 65535), readUint16(19), 1);
+        EXPECT_NEAR(static_cast<int>(y * 65535), readUint16(21), 1);
+        EXPECT_EQ(0xFFFF, readUint16(23));
+
+        EXPECT_EQ(0, readUint16(28));
+        EXPECT_EQ(0, readUint16(30));
+        EXPECT_EQ(0, readUint16(32));
+    }
 
+    TEST_F(TestProtocolSerializer, SerializeRebuildsOnColorSpaceChange) {
+        ProtocolSerializer serializer(_options);
+        EXPECT_EQ(COLORSPACE_RGB, serializer.Serialize(0)[14]);
+
+        _options->colorSpace = COLORSPACE_XYBRI;
+        const auto& payload = serializer.Serialize(1);
+        EXPECT_EQ(COLORSPACE_XYBRI, payload[14]);
+        EXPECT_EQ(0xFF, payload[23]);
+    }
+
+    static std::vector<uint8_t> SerializeWithPushBack(const std::shared_ptr<StreamOptions>& options, uint8_t seqNr) {
+        std::vector<uint8_t> payload;
+        const std::string protocolName = "HueStream";
+        payload.insert(payload.end(), protocolName.begin(), protocolName.end());
+        payload.push_back(0x01);
+        payload.push_back(0x00);
+        payload.push_back(seqNr);
+        payload.push_back(0x00);
+        payload.push_back(0x00);
+        payload.push_back(static_cast<uint8_t>(options->colorSpace));
+        payload.push_back(0x00);
+
+        for (auto l : *options->group->GetLights()) {
+            auto id = static_cast<uint16_t>(std::stoul(l->GetId()));
+            auto color = l->GetColor();
+            color.Clamp();
+            auto r = static_cast<uint16_t>(color.GetR() * 65535);
+            auto g = static_cast<uint16_t>(color.GetG() * 65535);
+            auto b = static_cast<uint16_t>(color.GetB() * 65535);
+            payload.push_back(0x00);
+            payload.push_back(static_cast<uint8_t>((id & 0xff00) >> 8));
+            payload.push_back(static_cast<uint8_t>(id & 0x00ff));
+            payload.push_back(static_cast<uint8_t>((r & 0xff00) >> 8));
+            payload.push_back(static_cast<uint8_t>(r & 0x00ff));
+            payload.push_back(static_cast<uint8_t>((g & 0xff00) >> 8));
+            payload.push_back(static_cast<uint8_t>(g & 0x00ff));
+            payload.push_back(static_cast<uint8_t>((b & 0xff00) >> 8));
+            payload.push_back(static_cast<uint8_t>(b & 0x00ff));
+        }
+        return payload;
+    }
+
+    static std::shared_ptr<Group> CreateColoredGroup(int lightCount) {
+        auto group = std::make_shared<Group>();
+        for (int i = 1; i <= lightCount; ++i) {
+            group->AddLight(std::to_string(i), 0, 0);
+            group->GetLights()->back()->SetColor(Color(i / 20.0, 1.0 - i / 20.0, 0.5));
+        }
+        return group;
+    }
+
+    TEST_F(TestProtocolSerializer, SerializeMatchesPushBackSerializer) {
+        _options->group = CreateColoredGroup(20);
+
+        ProtocolSerializer serializer(_options);
+        for (int seqNr = 0; seqNr < 3; ++seqNr) {
+            EXPECT_EQ(SerializeWithPushBack(_options, static_cast<uint8_t>(seqNr)),
+                      serializer.Serialize(static_cast<uint8_t>(seqNr)));
+        }
+        EXPECT_EQ(16 + 20 * 9, serializer.Serialize(42).size());
+    }
+
+    // benchmark, run with --gtest_also_run_disabled_tests
+    TEST_F(TestProtocolSerializer, DISABLED_SerializeBenchmark) {
+        const int frames = 2000;
+        _options->group = CreateColoredGroup(20);
+
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ++i) {
+            checksum += SerializeWithPushBack(_options, static_cast<uint8_t>(i)).size();
+        }
+        auto pushBackDuration = std::chrono::steady_clock::now() - start;
+
+        ProtocolSerializer serializer(_options);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ++i) {
+            checksum += serializer.Serialize(static_cast<uint8_t>(i)).size();
+        }
+        auto precompiledDuration = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(2 * frames * (16 + 20 * 9), checksum);
+
+        std::cout << "[ BENCHMARK] push_back serializer: "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(pushBackDuration).count() / frames
+                  << " ns/frame, precompiled serializer: "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(precompiledDuration).count() / frames
+                  << " ns/frame" << std::endl;
+    }
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ Copyright (C) 2019 Signify Holding
+ All Rights Reserved.
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "huestream/stream/SocketOptions.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace huestream;
+
+class FakeSocketUdp : public support::SocketUdp {
+public:
+    std::vector<std::pair<std::string, int>> options;
+    int status = support::SOCKET_STATUS_OK;
+
+    int set_send_buffer_size(int size) override {
+        options.emplace_back("sndbuf", size);
+        return status;
+    }
+
+    int set_type_of_service(int type_of_service) override {
+        options.emplace_back("tos", type_of_service);
+        return status;
+    }
+
+    int set_priority(int priority) override {
+        options.emplace_back("priority", priority);
+        return status;
+    }
+
+    int set_busy_poll(int microseconds) override {
+        options.emplace_back("busypoll", microseconds);
+        return status;
+    }
+};
+
+TEST(TestSocketOptions, DefaultsLeaveSocketUnchanged) {
+    auto socket = std::make_shared<FakeSocketUdp>();
+    EXPECT_TRUE(ApplySocketOptions(SocketOptions(), socket));
+    EXPECT_TRUE(socket->options.empty());
+}
+
+TEST(TestSocketOptions, AppliesOptions) {
+    auto socket = std::make_shared<FakeSocketUdp>();
+    SocketOptions options;
+    options.sendBufferSize = 8192;
+    options.dscp = 46;
+    options.priority = 6;
+    options.busyPollMicroseconds = 50;
+    EXPECT_TRUE(ApplySocketOptions(options, socket));
+
+    std::vector<std::pair<std::string, int>> expected = {{"sndbuf", 8192}, {"tos", 0xB8}, {"priority", 6}, {"busypoll", 50}};
+    EXPECT_EQ(expected, socket->options);
+}
+
+TEST(TestSocketOptions, ContinuesAfterUnsupportedOption) {
+    auto socket = std::make_shared<FakeSocketUdp>();
+    socket->status = support::SOCKET_STATUS_FAILED;
+    SocketOptions options;
+    options.sendBufferSize = 8192;
+    options.priority = 6;
+    EXPECT_FALSE(ApplySocketOptions(options, socket));
+    EXPECT_EQ(2u, socket->options.size());
+}
+
+#ifdef __linux__
+TEST(TestSocketOptions, AppliesToUdpSocket) {
+    auto socket = std::make_shared<support::SocketUdp>(support::SocketAddress("127.0.0.1", 0));
+    SocketOptions options;
+    options.sendBufferSize = 8192;
+    options.dscp = 46;
+    options.priority = 6;
+    EXPECT_TRUE(ApplySocketOptions(options, socket));
+    EXPECT_EQ(support::SOCKET_STATUS_OK, socket->bind());
+}
+#endif
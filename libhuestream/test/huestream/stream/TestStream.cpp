@@ -4,6 +4,8 @@
  ********************************************************************************/
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <huestream/stream/Stream.h>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -15,6 +17,7 @@
 #include "test/huestream/_mock/MockStreamStarter.h"
 #include "test/huestream/_mock/MockStreamFactory.h"
 
+using ::testing::AtLeast;
 using ::testing::AnyNumber;
 using ::testing::_;
 using ::testing::Expectation;
@@ -26,6 +29,15 @@ namespace huestream {
 MATCHER_P(MatchStreamSendSequence, seq, "Incorrect sequence number") { return arg[11] == seq; };
 MATCHER_P(MatchBridgeIpAddress, ipAddress, "Incorrect ip address") { return arg->GetIpAddress() == ipAddress; };
 
+class TestableStream : public Stream {
+ public:
+    using Stream::Stream;
+
+    const uint8_t* GetSerializerBuffer() {
+        return _serializer->Serialize(0).data();
+    }
+};
+
 
 class TestStream : public testing::Test {
  public:
@@ -44,6 +56,9 @@ class TestStream : public testing::Test {
         _appSettings->SetActivationOverride(ACTIVATION_OVERRIDELEVEL_SAMEGROUP);
 
         _mockConnector = std::make_shared<MockConnector>();
+        EXPECT_CALL(*_mockConnector, SetAsyncSend(_)).Times(AnyNumber());
+        EXPECT_CALL(*_mockConnector, SetSocketOptions(_)).Times(AnyNumber());
+        EXPECT_CALL(*_mockConnector, GetDroppedFrameCount()).Times(AnyNumber());
         _bridge = CreateBridge();
 
         _timeManager = std::make_shared<TimeManager>();
@@ -145,6 +160,73 @@ TEST_F(TestStream, StartWithRenderThread) {
     stop_correctly();
 }
 
+TEST_F(TestStream, StartWithPreciseFramePacing) {
+    _streamSettings->SetUsePreciseFramePacing(true);
+    EXPECT_CALL(*_mockStreamStarterPtr, StartStream(ACTIVATION_OVERRIDELEVEL_SAMEGROUP)).Times(1).WillOnce(
+        Invoke(&*_mockStreamStarterPtr, &MockStreamStarter::ActivateSuccess));
+    EXPECT_CALL(*_mockConnector, Connect(MatchBridgeIpAddress("SOMEIP"), 2100)).Times(1).WillOnce(Return(true));
+    EXPECT_CALL(*_mockConnector, Send(_, _)).Times(AnyNumber());
+
+    ASSERT_TRUE(_stream->StartWithRenderThread(_bridge));
+    _timeManager->Sleep(100);
+
+    auto statistics = _stream->GetFrameStatistics();
+    EXPECT_GE(statistics.frameCount, 10);
+    EXPECT_NEAR(5.0, statistics.meanFrameTimeMs, 1.0);
+
+    stop_correctly();
+}
+
+TEST_F(TestStream, StartWithSendThread) {
+    _streamSettings->SetUseSendThread(true);
+    EXPECT_CALL(*_mockStreamStarterPtr, StartStream(ACTIVATION_OVERRIDELEVEL_SAMEGROUP)).Times(1).WillOnce(
+        Invoke(&*_mockStreamStarterPtr, &MockStreamStarter::ActivateSuccess));
+    EXPECT_CALL(*_mockConnector, Connect(MatchBridgeIpAddress("SOMEIP"), 2100)).Times(1).WillOnce(Return(true));
+    EXPECT_CALL(*_mockConnector, Send(_, _)).Times(AtLeast(10));
+
+    ASSERT_TRUE(_stream->StartWithRenderThread(_bridge));
+    _timeManager->Sleep(100);
+
+    ASSERT_TRUE(_stream->IsStreaming());
+    auto statistics = _stream->GetFrameStatistics();
+    EXPECT_LE(statistics.droppedFrameCount, statistics.frameCount);
+
+    stop_correctly();
+}
+
+TEST_F(TestStream, StartWithConnectorSendingAsync) {
+    _streamSettings->SetUseSendThread(true);
+    EXPECT_CALL(*_mockConnector, SetAsyncSend(true)).WillOnce(Return(true));
+    EXPECT_CALL(*_mockConnector, GetDroppedFrameCount()).WillRepeatedly(Return(3));
+    start_correctly_without_renderthread();
+
+    EXPECT_CALL(*_mockConnector, Send(MatchStreamSendSequence(0), _)).WillOnce(Return(true));
+    _stream->RenderSingleFrame();
+
+    auto statistics = _stream->GetFrameStatistics();
+    EXPECT_EQ(1, statistics.sendCount);
+    EXPECT_EQ(3, statistics.droppedFrameCount);
+
+    stop_correctly();
+}
+
+TEST_F(TestStream, StartPassesSocketOptionsToConnector) {
+    _streamSettings->SetSocketSendBufferSize(16384);
+    _streamSettings->SetSocketDscp(46);
+    _streamSettings->SetSocketPriority(6);
+    _streamSettings->SetSocketBusyPollMicroseconds(50);
+    SocketOptions options;
+    EXPECT_CALL(*_mockConnector, SetSocketOptions(_)).WillOnce(SaveArg<0>(&options));
+    start_correctly_without_renderthread();
+
+    EXPECT_EQ(16384, options.sendBufferSize);
+    EXPECT_EQ(46, options.dscp);
+    EXPECT_EQ(6, options.priority);
+    EXPECT_EQ(50, options.busyPollMicroseconds);
+
+    stop_correctly();
+}
+
 TEST_F(TestStream, StartWithoutRenderThread) {
     start_correctly_without_renderthread();
     _timeManager->Sleep(100);
@@ -157,6 +239,76 @@ TEST_F(TestStream, StartWithoutRenderThread) {
     stop_correctly();
 }
 
+TEST_F(TestStream, SendStatistics) {
+    start_correctly_without_renderthread();
+
+    EXPECT_CALL(*_mockConnector, Send(_, _)).WillOnce(Return(true)).WillOnce(Return(false));
+    _stream->RenderSingleFrame();
+    _stream->RenderSingleFrame();
+
+    auto statistics = _stream->GetFrameStatistics();
+    EXPECT_EQ(2, statistics.sendCount);
+    EXPECT_EQ(1, statistics.sendFailureCount);
+    EXPECT_GE(statistics.maxSendTimeMs, statistics.meanSendTimeMs);
+
+    stop_correctly();
+}
+
+TEST_F(TestStream, FramesAreCopiedOnlyBySendThread) {
+    for (int i = 1; i <= 20; ++i) {
+        _bridge->GetGroup()->AddLight(std::to_string(i), 0.0, 0.0);
+    }
+
+    std::mutex mutex;
+    const uint8_t* serializerBuffer = nullptr;
+    int64_t frameCount = 0;
+    int64_t copiedBytes = 0;
+    unsigned int frameSize = 0;
+    EXPECT_CALL(*_mockStreamStarterPtr, StartStream(_)).WillRepeatedly(
+        Invoke(&*_mockStreamStarterPtr, &MockStreamStarter::ActivateSuccess));
+    EXPECT_CALL(*_mockStreamStarterPtr, Stop()).WillRepeatedly(
+        Invoke(&*_mockStreamStarterPtr, &MockStreamStarter::DeactivateSuccess));
+    EXPECT_CALL(*_mockConnector, Connect(_, _)).WillRepeatedly(Return(true));
+    EXPECT_CALL(*_mockConnector, Disconnect()).Times(AnyNumber());
+    EXPECT_CALL(*_mockConnector, Send(_, _)).WillRepeatedly(Invoke([&](const char* buffer, unsigned int size) {
+        // a frame which does not come straight from the serializer has been copied before reaching the connector
+        std::lock_guard<std::mutex> lock(mutex);
+        frameCount++;
+        frameSize = size;
+        if (reinterpret_cast<const uint8_t*>(buffer) != serializerBuffer) {
+            copiedBytes += size;
+        }
+        return true;
+    }));
+
+    int64_t copiedPerFrame[2] = {};
+    for (auto useSendThread : {false, true}) {
+        _streamSettings->SetUseSendThread(useSendThread);
+        auto stream = std::make_shared<TestableStream>(_streamSettings, _appSettings, _timeManager, _mockConnector,
+                                                       _mockStreamFactoryPtr);
+        ASSERT_TRUE(stream->Start(_bridge));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            serializerBuffer = stream->GetSerializerBuffer();
+            frameCount = 0;
+            copiedBytes = 0;
+        }
+
+        for (int frame = 0; frame < 20; ++frame) {
+            stream->RenderSingleFrame();
+            _timeManager->Sleep(10);
+        }
+        stream->Stop();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_GT(frameCount, 0);
+        copiedPerFrame[useSendThread ? 1 : 0] = copiedBytes / frameCount;
+    }
+
+    EXPECT_EQ(0, copiedPerFrame[0]);
+    EXPECT_EQ(frameSize, copiedPerFrame[1]);
+}
+
 TEST_F(TestStream, FailClientConnectRetries) {
 
     Expectation start = EXPECT_CALL(*_mockStreamStarterPtr, StartStream(ACTIVATION_OVERRIDELEVEL_SAMEGROUP)).Times(1).WillOnce(
@@ -176,6 +328,24 @@ TEST_F(TestStream, FailClientConnectRetries) {
     _stream->Stop();
 }
 
+TEST_F(TestStream, ConnectStatistics) {
+    Expectation start = EXPECT_CALL(*_mockStreamStarterPtr, StartStream(ACTIVATION_OVERRIDELEVEL_SAMEGROUP)).Times(1).WillOnce(
+        Invoke(&*_mockStreamStarterPtr, &MockStreamStarter::ActivateSuccess));
+    EXPECT_CALL(*_mockConnector, Connect(MatchBridgeIpAddress("SOMEIP"), 2100)).Times(2).After(start)
+        .WillOnce(Return(false)).WillOnce(Return(true));
+    EXPECT_CALL(*_mockConnector, Send(_, _)).Times(0);
+
+    ASSERT_TRUE(_stream->Start(_bridge));
+    ASSERT_TRUE(_stream->IsStreaming());
+
+    auto statistics = _stream->GetFrameStatistics();
+    EXPECT_EQ(2, statistics.connectAttemptCount);
+    EXPECT_GE(statistics.connectTimeMs, 50.0);
+    EXPECT_LT(statistics.connectTimeMs, 1000.0);
+
+    stop_correctly();
+}
+
 TEST_F(TestStream, FailCantActivate) {
     EXPECT_CALL(*_mockStreamStarterPtr, StartStream(ACTIVATION_OVERRIDELEVEL_SAMEGROUP)).Times(1).WillOnce(Return(false));
     EXPECT_CALL(*_mockConnector, Connect(_, _)).Times(0);
@@ -269,6 +439,45 @@ TEST_F(TestStream, UpdateBridge) {
     stop_correctly();
 }
 
+TEST_F(TestStream, SuppressUnchangedFrames) {
+    _streamSettings->SetSuppressUnchangedFrames(true);
+    _streamSettings->SetKeepAliveFrequency(1);
+    start_correctly_without_renderthread();
+    auto bridgeCpy = CreateBridge();
+    bridgeCpy->GetGroup()->AddLight("1", 0.1, 0.1, 0.1, "1", "LTC001");
+    _stream->UpdateBridgeGroup(bridgeCpy);
+
+    EXPECT_CALL(*_mockConnector, Send(MatchStreamSendSequence(0), 25)).Times(1);
+    _stream->RenderSingleFrame();
+    _stream->RenderSingleFrame();
+    _stream->RenderSingleFrame();
+
+    EXPECT_CALL(*_mockConnector, Send(MatchStreamSendSequence(1), 25)).Times(1);
+    bridgeCpy->GetGroup()->GetLights()->at(0)->SetColor(Color(0.0, 1.0, 0.0));
+    _stream->RenderSingleFrame();
+
+    EXPECT_EQ(4, _stream->GetStreamCounter());
+    EXPECT_EQ(2, _stream->GetFrameStatistics().suppressedFrameCount);
+    stop_correctly();
+}
+
+TEST_F(TestStream, SendUnchangedFramesAtKeepAliveFrequency) {
+    _streamSettings->SetSuppressUnchangedFrames(true);
+    _streamSettings->SetKeepAliveFrequency(20);
+    start_correctly_without_renderthread();
+
+    EXPECT_CALL(*_mockConnector, Send(MatchStreamSendSequence(0), 16)).Times(1);
+    _stream->RenderSingleFrame();
+    _stream->RenderSingleFrame();
+
+    EXPECT_CALL(*_mockConnector, Send(MatchStreamSendSequence(1), 16)).Times(1);
+    _timeManager->Sleep(60);
+    _stream->RenderSingleFrame();
+
+    EXPECT_EQ(1, _stream->GetFrameStatistics().suppressedFrameCount);
+    stop_correctly();
+}
+
 TEST_F(TestStream, UpdateBridgeRobustAgainstInvalidGroup) {
     start_correctly_without_renderthread();
     _timeManager->Sleep(100);